@@ -1,25 +1,25 @@
-/* Gigal: An open source system for classification learning from very large data
-** Copyright (C) 2012 Geoffrey I Webb
-**
-** This header handles operating system specific issues around opening large files
-**
-** This program is free software: you can redistribute it and/or modify
-** it under the terms of the GNU General Public License as published by
-** the Free Software Foundation, either version 3 of the License, or
-** (at your option) any later version.
-** 
-** This program is distributed in the hope that it will be useful,
-** but WITHOUT ANY WARRANTY; without even the implied warranty of
-** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
-** GNU General Public License for more details.
-** 
-** You should have received a copy of the GNU General Public License
-** along with this program. If not, see <http://www.gnu.org/licenses/>.
-**
-** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
-*/
-
-#define _FILE_OFFSET_BITS 64
-#include <stdio.h>
-
-typedef FILE FILEtype;
+/* Gigal: An open source system for classification learning from very large data
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This header handles operating system specific issues around opening large files
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+
+#define _FILE_OFFSET_BITS 64
+#include <stdio.h>
+
+typedef FILE FILEtype;
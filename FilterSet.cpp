@@ -1,22 +1,45 @@
-#include "FilterSet.h"
-
-FilterSet::FilterSet(void)
-{
-}
-
-FilterSet::~FilterSet(void)
-{
-}
-
-/// create a new InstanceStream by applying the set of filters
-InstanceStream* FilterSet::apply(InstanceStream* source) {
-  FilterSet::iterator it = begin();
-
-  while (it != end()) {
-    (*it)->setSource(*source);
-    source = *it;
-    ++it;
-  }
-
-  return source;
-}
+#include "FilterSet.h"
+
+FilterSet::FilterSet(void)
+{
+}
+
+FilterSet::~FilterSet(void)
+{
+}
+
+/// create a new InstanceStream by applying the set of filters.
+/// Each filter is first set up on the stream beneath it.  Then, if the last filter maps each instance of its source
+/// to one instance, it and the chain of such filters beneath it are composed into a single transform of the stream
+/// beneath the chain, so that an instance passes through them all in one step.
+InstanceStream* FilterSet::apply(InstanceStream* source) {
+  FilterSet::iterator it = begin();
+
+  while (it != end()) {
+    (*it)->setSource(*source);
+    source = *it;
+    ++it;
+  }
+
+  std::vector<InstanceStream*> chain;
+  InstanceStream *base = source;
+
+  while (base->getTransformSource() != NULL) {
+    chain.push_back(base);
+    base = base->getTransformSource();
+  }
+
+  if (chain.empty()) return source;
+
+  InstanceStream::Transform t;
+
+  t.init(*base);
+
+  for (std::vector<InstanceStream*>::reverse_iterator f = chain.rbegin(); f != chain.rend(); ++f) {
+    (*f)->composeTransform(t);
+  }
+
+  transform_.setTransform(*base, *source, t);
+
+  return &transform_;
+}
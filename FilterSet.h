@@ -1,11 +1,15 @@
-#pragma once
-#include "instanceStreamFilter.h"
-#include "utils.h"
-
-class FilterSet : public ptrVec<InstanceStreamFilter> {
-public:
-  FilterSet(void);
-  ~FilterSet();
-
-  InstanceStream* apply(InstanceStream *source); ///< create a new InstanceStream by applying the set of filters
-};
+#pragma once
+#include "instanceStreamFilter.h"
+#include "instanceStreamTransform.h"
+#include "utils.h"
+
+class FilterSet : public ptrVec<InstanceStreamFilter> {
+public:
+  FilterSet(void);
+  ~FilterSet();
+
+  InstanceStream* apply(InstanceStream *source); ///< create a new InstanceStream by applying the set of filters
+
+private:
+  InstanceStreamTransform transform_;  ///< applies the filters, and the filters beneath them that map each instance to one instance, in one step
+};
@@ -78,6 +78,18 @@ void aode::train(const instance &inst) {
 	xxyDist_.update(inst);
 }
 
+void aode::train(const InstanceBatch &batch) {
+	xxyDist_.update(batch);
+}
+
+void aode::train(const InstanceBatch &batch, WorkerPool &pool) {
+	xxyDist_.update(batch, pool);
+}
+
+bool aode::trainFromCounts(InstanceStream &is, WorkerPool *pool) {
+	return is.countPairs(xxyDist_, pool);
+}
+
 /// true iff no more passes are required. updated by finalisePass()
 bool aode::trainingIsFinished() {
 	return trainingIsFinished_;
@@ -160,8 +172,7 @@ void aode::classify(const instance &inst, std::vector<double> &classDist) {
                 const CatValue x1Val = inst.getCatVal(x1);
                 const unsigned int noX1Vals = xxyDist_.getNoValues(x1);
 
-                constXYSubDist xySubDist(xxyDist_.getXYSubDist(x1, x1Val),
-                                noClasses_);
+                const constXYSubDist xySubDist(xxyDist_.getXYSubDist(x1, x1Val));
 
                 for (CategoricalAttribute x2 = 0; x2 < x1; x2++) {
 
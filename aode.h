@@ -78,6 +78,30 @@ public:
 	 */
 	void train(const instance &inst);
 
+	/**
+	 * Train an aode with each instance in a batch, one pair of attributes at a time.
+	 *
+	 * @param batch Training instances
+	 */
+	void train(const InstanceBatch &batch);
+
+	/**
+	 * Train an aode with a batch, the workers of the pool sharing the pairs of attributes.
+	 *
+	 * @param batch Training instances
+	 * @param pool The workers
+	 */
+	void train(const InstanceBatch &batch, WorkerPool &pool);
+
+	/**
+	 * Train an aode from the counts of the pairs of attributes that the stream can provide without a pass.
+	 *
+	 * @param is The training stream
+	 * @param pool The workers, or NULL
+	 * @return false if the stream cannot provide the counts
+	 */
+	bool trainFromCounts(InstanceStream &is, WorkerPool *pool);
+
 	/**
 	 * Calculates the class membership probabilities for the given test instance.
 	 *
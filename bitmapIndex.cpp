@@ -0,0 +1,181 @@
+/* Open source system for classification learning from very large data
+** Class for a vertical index of the instances of a stream
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "bitmapIndex.h"
+#include "instanceBatch.h"
+
+#include <assert.h>
+
+BitmapIndex::BitmapIndex() : noCatAtts_(0), noWords_(0), count_(0), built_(false) {
+}
+
+BitmapIndex::~BitmapIndex(void) {
+}
+
+void BitmapIndex::clear() {
+  std::vector<unsigned long long>().swap(bits_);
+  valueStart_.clear();
+  noWords_ = 0;
+  count_ = 0;
+  built_ = false;
+}
+
+size_t BitmapIndex::getBytes() const {
+  return bits_.size() * sizeof(unsigned long long);
+}
+
+void BitmapIndex::build(InstanceStream &is) {
+  clear();
+
+  noCatAtts_ = is.getNoCatAtts();
+  count_ = is.size();
+  noWords_ = static_cast<size_t>((count_ + 63) / 64);
+
+  valueStart_.resize(noCatAtts_ + 1);
+
+  size_t noBitmaps = 0;
+
+  for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+    valueStart_[a] = noBitmaps;
+    noBitmaps += is.getNoValues(a);
+  }
+
+  valueStart_[noCatAtts_] = noBitmaps;
+  noBitmaps += is.getNoClasses();
+
+  bits_.assign(noBitmaps * noWords_, 0);
+
+  // the instances are numbered in the order the stream returns them
+  InstanceBatch batch(is);
+  InstanceCount next = 0;
+
+  is.rewind();
+
+  while (is.advance(batch, batch.capacity()) != 0) {
+    if (next + batch.size() > count_) break;  // the stream has grown since it was sized
+
+    switch (batch.getCatWidth()) {
+    case 1: addCols<unsigned char>(batch, next); break;
+    case 2: addCols<unsigned short>(batch, next); break;
+    default: addCols<CatValue>(batch, next); break;
+    }
+
+    const CatValue *y = batch.getClasses();
+
+    for (unsigned int i = 0; i < batch.size(); i++) {
+      const InstanceCount inst = next + i;
+      bits_[(valueStart_[noCatAtts_] + y[i]) * noWords_ + static_cast<size_t>(inst >> 6)] |= 1ULL << (inst & 63);
+    }
+
+    next += batch.size();
+  }
+
+  assert(next == count_);
+
+  built_ = true;
+}
+
+template <typename T>
+void BitmapIndex::addCols(const InstanceBatch &batch, const InstanceCount first) {
+  for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+    const T *v = batch.getCatCol<T>(a);
+    unsigned long long *attBits = &bits_[valueStart_[a] * noWords_];
+
+    for (unsigned int i = 0; i < batch.size(); i++) {
+      const InstanceCount inst = first + i;
+      attBits[v[i] * noWords_ + static_cast<size_t>(inst >> 6)] |= 1ULL << (inst & 63);
+    }
+  }
+}
+
+// the number of bits set in each byte of x
+static inline unsigned long long countBytes(unsigned long long x) {
+  x = x - ((x >> 1) & 0x5555555555555555ULL);
+  x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+  return (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+}
+
+// the sum of the bytes of x
+static inline InstanceCount sumBytes(unsigned long long x) {
+  x = (x & 0x00ff00ff00ff00ffULL) + ((x >> 8) & 0x00ff00ff00ff00ffULL);
+  return (x * 0x0001000100010001ULL) >> 48;
+}
+
+// The byte counts of up to 31 words are summed before their bytes are added, as no byte can then exceed 31*8,
+// so the inner loops have no multiply and vectorise.  Words supplies each word: from one bitmap, the intersection
+// of two, or the intersection of two that is also stored.
+template <typename Words>
+static inline InstanceCount countWords(const Words &words, const size_t n) {
+  InstanceCount c = 0;
+  size_t i = 0;
+
+  while (i < n) {
+    const size_t end = n - i > 31 ? i + 31 : n;
+    unsigned long long bytes = 0;
+
+    for (; i < end; i++) {
+      bytes += countBytes(words(i));
+    }
+
+    c += sumBytes(bytes);
+  }
+
+  return c;
+}
+
+namespace {
+  class Bitmap {
+  public:
+    Bitmap(const unsigned long long *a) : a_(a) {}
+    inline unsigned long long operator()(const size_t i) const { return a_[i]; }
+  private:
+    const unsigned long long *a_;
+  };
+
+  class And {
+  public:
+    And(const unsigned long long *a, const unsigned long long *b) : a_(a), b_(b) {}
+    inline unsigned long long operator()(const size_t i) const { return a_[i] & b_[i]; }
+  private:
+    const unsigned long long *a_;
+    const unsigned long long *b_;
+  };
+
+  class StoreAnd {
+  public:
+    StoreAnd(const unsigned long long *a, const unsigned long long *b, unsigned long long *result) : a_(a), b_(b), result_(result) {}
+    inline unsigned long long operator()(const size_t i) const { return result_[i] = a_[i] & b_[i]; }
+  private:
+    const unsigned long long *a_;
+    const unsigned long long *b_;
+    unsigned long long *result_;
+  };
+}
+
+InstanceCount BitmapIndex::count(const unsigned long long *a, const size_t n) {
+  return countWords(Bitmap(a), n);
+}
+
+InstanceCount BitmapIndex::countAnd(const unsigned long long *a, const unsigned long long *b, const size_t n) {
+  return countWords(And(a, b), n);
+}
+
+InstanceCount BitmapIndex::intersect(const unsigned long long *a, const unsigned long long *b, unsigned long long *result, const size_t n) {
+  return countWords(StoreAnd(a, b, result), n);
+}
@@ -0,0 +1,71 @@
+/* Open source system for classification learning from very large data
+** Class for a vertical index of the instances of a stream
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "instanceStream.h"
+
+#include <vector>
+
+/// A vertical index of the instances of a stream: a bitmap for each value of each categorical attribute and for each class,
+/// in which bit i is set iff instance i has that value.  The number of instances with a combination of values is the number
+/// of bits set in the intersection of their bitmaps, so a distribution can be counted 64 instances at a time from a handful
+/// of bitmaps, rather than by a pass that visits every instance.  A mask, whose bit i is set iff instance i is wanted, such
+/// as the training instances of a fold of a cross validation, restricts a count to a subset of the instances.
+///
+/// The bits are counted a word at a time with shifts, masks and adds that the compiler can vectorise, so that no
+/// instruction set beyond that of the build target is needed.
+class BitmapIndex
+{
+public:
+  BitmapIndex();
+  ~BitmapIndex(void);
+
+  void build(InstanceStream &is);       ///< index the instances of a stream, read a batch at a time from its start.  The stream's position is then undefined.
+  void clear();                         ///< discard the bitmaps
+
+  inline bool isBuilt() const { return built_; }                 ///< true iff the bitmaps have been built
+  inline InstanceCount size() const { return count_; }           ///< the number of instances indexed
+  inline size_t getNoWords() const { return noWords_; }          ///< the number of 64 bit words in each bitmap
+  inline unsigned int getNoCatAtts() const { return noCatAtts_; }
+  size_t getBytes() const;              ///< the number of bytes holding the bitmaps
+
+  /// the bitmap of the instances whose value of categorical attribute a is v
+  inline const unsigned long long *getValueBits(const CategoricalAttribute a, const CatValue v) const {
+    return &bits_[(valueStart_[a] + v) * noWords_];
+  }
+
+  /// the bitmap of the instances of class y
+  inline const unsigned long long *getClassBits(const CatValue y) const { return getValueBits(noCatAtts_, y); }
+
+  static InstanceCount count(const unsigned long long *a, const size_t n);  ///< the number of bits set in the n words of a
+  static InstanceCount countAnd(const unsigned long long *a, const unsigned long long *b, const size_t n);  ///< the number of bits set in both of the n words of a and b
+  static InstanceCount intersect(const unsigned long long *a, const unsigned long long *b, unsigned long long *result, const size_t n);  ///< store the intersection of the n words of a and b in result, which may be a or b, and return the number of bits it sets
+
+private:
+  template <typename T>
+  void addCols(const InstanceBatch &batch, const InstanceCount first);  ///< set the bits of the instances of a batch whose categorical columns are of type T, the first being instance first
+
+  std::vector<unsigned long long> bits_;  ///< the bitmap of each value of each attribute, then of each class, each of noWords_ words
+  std::vector<size_t> valueStart_;      ///< the index of the bitmap of the first value of each attribute and, last, of the first class
+  unsigned int noCatAtts_;              ///< the number of categorical attributes
+  size_t noWords_;                      ///< the number of words in each bitmap
+  InstanceCount count_;                 ///< the number of instances indexed
+  bool built_;                          ///< true iff the bitmaps have been built
+};
@@ -64,12 +64,13 @@ void getMutualInformation(xyDist &dist, std::vector<float> &mi)
  * CMI(X1,X2|Y)= = /_   P(x1,x2,y) log-------------
  *               x1,x2,y              P(x1|y)P(x2|y)
  *
+ * Only the pairs held by dist are calculated, so the whole table may be filled one block of dist at a time.
  */
 void getCondMutualInf(xxyDist &dist, crosstab<float> &cmi)
 {
   const double totalCount = dist.xyCounts.count;
 
-  for (CategoricalAttribute x1 = 1; x1 < dist.getNoCatAtts(); x1++) {
+  for (CategoricalAttribute x1 = dist.getFirstX1(); x1 < dist.getEndX1(); x1++) {
       for (CategoricalAttribute x2 = 0; x2 < x1; x2++) {
         float m = 0.0;
         for (CatValue v1 = 0; v1 < dist.getNoValues(x1); v1++) {
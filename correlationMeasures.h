@@ -50,6 +50,8 @@ void getMutualInformation(xyDist &dist, std::vector<float> &mi);
  * 
  * CMI(X;Y|C) = H(X|C) - H(X|Y,C)
  * 
+ * When dist holds a block of the pairs, only the entries of cmi for those pairs are set.
+ * 
  * @param dist  counts for the xy distributions.
  * @param[out] cmi class conditional mutual information between the attributes.
  */
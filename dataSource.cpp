@@ -0,0 +1,592 @@
+/* Open source system for classification learning from very large data
+** Class for reading the bytes of a data file that may be compressed
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "dataSource.h"
+
+#include <string.h>
+#include <zlib.h>
+#ifdef GIGAL_ZSTD
+#include <zstd.h>
+#endif
+#include <stdlib.h>
+#include <sys/time.h>
+#include <sys/stat.h>
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const size_t INPUT_SIZE = 1 << 18;  ///< the number of compressed bytes read at a time
+static const unsigned int READ_AHEAD_BUFFERS = 2;  ///< the number of buffers used to read ahead
+
+// the wall clock time in seconds
+static double now() {
+  struct timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec + t.tv_usec * 1e-6;
+}
+
+DataSource::DataSource()
+  : f_(NULL), format_(PLAIN), stream_(false), position_(0), readAhead_(false), threaded_(false), decoder_(NULL), inPos_(0), inEnd_(0), inEOF_(false), frameDone_(false),
+    running_(false), ringBlockBytes_(0), head_(0), full_(0), decoded_(false), stop_(false), bytesRead_(0), readTime_(0),
+    block_(NULL), blockPos_(0), blockEnd_(0), fromRing_(false), stallTime_(0),
+    keptBytes_(0), keeping_(false), allKept_(false), servingKept_(false), nextKept_(0)
+{ pthread_mutex_init(&mutex_, NULL);
+  pthread_cond_init(&filled_, NULL);
+  pthread_cond_init(&emptied_, NULL);
+  errorMsg_[0] = '\0';
+}
+
+DataSource::~DataSource(void)
+{ close();
+  freeRing();
+
+  pthread_cond_destroy(&emptied_);
+  pthread_cond_destroy(&filled_);
+  pthread_mutex_destroy(&mutex_);
+}
+
+DataSource::Format DataSource::detect(const char *fileName) {
+  // reading the magic number would consume the start of a pipe
+  if (isStream(fileName)) return PLAIN;
+
+  FILE *f = fopen(fileName, "rb");
+
+  if (f == NULL) return PLAIN;
+
+  unsigned char magic[4];
+  const size_t n = fread(magic, 1, sizeof(magic), f);
+
+  fclose(f);
+
+  if (n >= 2 && magic[0] == 0x1F && magic[1] == 0x8B) return GZIP;
+  if (n == 4 && magic[0] == 0x28 && magic[1] == 0xB5 && magic[2] == 0x2F && magic[3] == 0xFD) return ZSTD;
+
+  return PLAIN;
+}
+
+bool DataSource::isStream(const char *fileName) {
+  if (strcmp(fileName, "-") == 0) return true;
+
+  struct stat buf;
+
+  return stat(fileName, &buf) == 0 && !S_ISREG(buf.st_mode);
+}
+
+void DataSource::open(const char *fileName) {
+  close();
+
+  name_.assign(fileName, fileName + strlen(fileName) + 1);
+  format_ = detect(fileName);
+  stream_ = isStream(fileName);
+
+#ifndef GIGAL_ZSTD
+  if (format_ == ZSTD) error("%s is zstd compressed but zstd support is not built in (build with make ZSTD=1)", fileName);
+#endif
+
+  if (strcmp(fileName, "-") == 0) {
+    // the standard input is read through a duplicate so that closing the source leaves it open
+#ifdef _MSC_VER
+    f_ = _fdopen(_dup(_fileno(stdin)), "rb");
+#else
+    f_ = fdopen(dup(fileno(stdin)), "rb");
+#endif
+  }
+  else {
+    f_ = fopen(fileName, "rb");
+  }
+
+  if (f_ == NULL) error("Cannot open input file %s", fileName);
+
+#ifndef _MSC_VER
+  if (!stream_) posix_fadvise(fileno(f_), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+  position_ = 0;
+  bytesRead_ = 0;
+  readTime_ = stallTime_ = 0;
+
+#if defined(_SC_PHYS_PAGES) && defined(_SC_PAGE_SIZE)
+  keepLimit_ = static_cast<unsigned long long>(sysconf(_SC_PHYS_PAGES)) * sysconf(_SC_PAGE_SIZE) / 4;
+#else
+  keepLimit_ = 1ULL << 28;
+#endif
+
+  if (format_ != PLAIN) {
+    in_.resize(INPUT_SIZE);
+    allocRing(RING_BLOCKS, BLOCK_SIZE);
+    keeping_ = true;
+    threaded_ = true;
+    startThread(0);
+  }
+  else if (readAhead_) {
+    allocRing(READ_AHEAD_BUFFERS, READ_AHEAD_SIZE);
+    threaded_ = true;
+    startThread(0);
+  }
+}
+
+void DataSource::setReadAhead(const bool readAhead) {
+  readAhead_ = readAhead;
+
+  if (f_ == NULL || format_ != PLAIN || threaded_ == readAhead) return;
+
+  // continue from the same position in the file
+  const unsigned long long offset = position_;
+
+  if (running_) stopThread();
+
+  threaded_ = readAhead;
+
+  if (threaded_) {
+    allocRing(READ_AHEAD_BUFFERS, READ_AHEAD_SIZE);
+    startThread(offset);
+  }
+  else {
+    fseeko(f_, static_cast<off_t>(offset), SEEK_SET);
+  }
+}
+
+unsigned long long DataSource::getBytesRead() {
+  pthread_mutex_lock(&mutex_);
+  const unsigned long long bytes = bytesRead_;
+  pthread_mutex_unlock(&mutex_);
+
+  return bytes;
+}
+
+double DataSource::getReadTime() {
+  pthread_mutex_lock(&mutex_);
+  const double t = readTime_;
+  pthread_mutex_unlock(&mutex_);
+
+  return t;
+}
+
+void DataSource::allocRing(const unsigned int noBlocks, const size_t blockBytes) {
+  if (ring_.size() == noBlocks && ringBlockBytes_ == blockBytes) return;
+
+  freeRing();
+
+  ring_.assign(noBlocks, static_cast<char*>(NULL));
+  ringBlockBytes_ = blockBytes;
+
+  for (unsigned int i = 0; i < noBlocks; i++) {
+#ifdef _MSC_VER
+    ring_[i] = static_cast<char*>(malloc(blockBytes));
+#else
+    void *b;
+    ring_[i] = posix_memalign(&b, 4096, blockBytes) == 0 ? static_cast<char*>(b) : NULL;
+#endif
+    if (ring_[i] == NULL) error("Out of memory");
+  }
+
+  blockSize_.assign(noBlocks, 0);
+}
+
+void DataSource::freeRing() {
+  for (unsigned int i = 0; i < ring_.size(); i++) free(ring_[i]);
+
+  ring_.clear();
+  ringBlockBytes_ = 0;
+}
+
+void DataSource::close() {
+  if (f_ == NULL) return;
+
+  if (running_) stopThread();
+  endDecoder();
+  dropDecoded();
+  keeping_ = servingKept_ = false;
+  threaded_ = false;
+
+  fclose(f_);
+  f_ = NULL;
+  format_ = PLAIN;
+  stream_ = false;
+}
+
+size_t DataSource::read(char *buffer, const size_t n) {
+  if (!threaded_) {
+    const double start = now();
+    const size_t got = readFile(buffer, n);
+    stallTime_ += now() - start;
+    position_ += got;
+    return got;
+  }
+
+  size_t got = 0;
+
+  while (got < n) {
+    if (blockPos_ == blockEnd_ && !nextBlock()) break;
+
+    size_t len = blockEnd_ - blockPos_;
+    if (len > n - got) len = n - got;
+
+    memcpy(buffer + got, block_ + blockPos_, len);
+    blockPos_ += len;
+    got += len;
+  }
+
+  position_ += got;
+
+  return got;
+}
+
+void DataSource::rewind() {
+  if (stream_) {
+    if (position_ != 0) error("Cannot read %s again, as it is a pipe", &name_[0]);
+    return;
+  }
+
+  position_ = 0;
+
+  if (!threaded_) {
+    ::rewind(f_);
+    return;
+  }
+
+  if (running_) stopThread();
+
+  if (allKept_) {
+    // the whole of the decoded data is in memory
+    servingKept_ = true;
+    nextKept_ = 0;
+    block_ = NULL;
+    blockPos_ = blockEnd_ = 0;
+  }
+  else {
+    // restart the decoder, keeping the blocks of the new pass
+    dropDecoded();
+    keeping_ = format_ != PLAIN;
+    startThread(0);
+  }
+}
+
+void DataSource::seek(const unsigned long long offset) {
+  if (format_ == PLAIN) {
+    if (threaded_) {
+      if (running_) stopThread();
+      startThread(offset);
+    }
+    else {
+      fseeko(f_, static_cast<off_t>(offset), SEEK_SET);
+    }
+    position_ = offset;
+    return;
+  }
+
+  if (offset < position_) rewind();
+
+  if (servingKept_) {
+    // all but the last kept block are full, so the block holding the offset can be found directly
+    const unsigned long long b = offset / BLOCK_SIZE;
+
+    block_ = NULL;
+    blockPos_ = blockEnd_ = 0;
+
+    if (b >= kept_.size()) {
+      nextKept_ = kept_.size();
+      position_ = keptBytes_;
+      return;
+    }
+
+    nextKept_ = static_cast<unsigned int>(b);
+    position_ = b * BLOCK_SIZE;
+  }
+
+  // discard the decoded data up to the offset
+  while (position_ < offset) {
+    if (blockPos_ == blockEnd_ && !nextBlock()) break;
+
+    size_t len = blockEnd_ - blockPos_;
+    if (len > offset - position_) len = static_cast<size_t>(offset - position_);
+
+    blockPos_ += len;
+    position_ += len;
+  }
+}
+
+void DataSource::initDecoder() {
+  if (format_ == GZIP) {
+    z_stream *zs = static_cast<z_stream*>(decoder_);
+
+    if (zs == NULL) {
+      zs = new z_stream;
+      memset(zs, 0, sizeof(z_stream));
+      if (inflateInit2(zs, 15 + 32) != Z_OK) error("Cannot initialise the decompressor for %s", &name_[0]);  // 15 + 32 accepts gzip and zlib headers
+      decoder_ = zs;
+    }
+    else {
+      inflateReset(zs);
+    }
+  }
+#ifdef GIGAL_ZSTD
+  else if (format_ == ZSTD) {
+    if (decoder_ == NULL) {
+      decoder_ = ZSTD_createDCtx();
+      if (decoder_ == NULL) error("Cannot initialise the decompressor for %s", &name_[0]);
+    }
+    else {
+      ZSTD_DCtx_reset(static_cast<ZSTD_DCtx*>(decoder_), ZSTD_reset_session_only);
+    }
+  }
+#endif
+
+  inPos_ = inEnd_ = 0;
+  inEOF_ = false;
+  frameDone_ = false;
+}
+
+void DataSource::endDecoder() {
+  if (decoder_ == NULL) return;
+
+  if (format_ == GZIP) {
+    z_stream *zs = static_cast<z_stream*>(decoder_);
+    inflateEnd(zs);
+    delete zs;
+  }
+#ifdef GIGAL_ZSTD
+  else if (format_ == ZSTD) {
+    ZSTD_freeDCtx(static_cast<ZSTD_DCtx*>(decoder_));
+  }
+#endif
+
+  decoder_ = NULL;
+}
+
+size_t DataSource::readFile(void *out, const size_t n) {
+  const double start = now();
+  const size_t got = fread(out, 1, n, f_);
+  const double t = now() - start;
+
+  // the counters are also read by the reader when the file is read on the background thread
+  if (threaded_) pthread_mutex_lock(&mutex_);
+  bytesRead_ += got;
+  readTime_ += t;
+  if (threaded_) pthread_mutex_unlock(&mutex_);
+
+  return got;
+}
+
+// called on the background thread.  Errors are recorded in errorMsg_ and reported by the reader.
+size_t DataSource::decode(char *out, const size_t n) {
+  if (format_ == PLAIN) return readFile(out, n);
+
+  size_t got = 0;
+
+  while (got < n) {
+    if (inPos_ == inEnd_ && !inEOF_) {
+      inEnd_ = readFile(&in_[0], in_.size());
+      inPos_ = 0;
+      if (inEnd_ < in_.size()) inEOF_ = true;
+    }
+
+    if (inPos_ == inEnd_) {
+      // a file may hold several gzip members or zstd frames, but must not end within one
+      if (!frameDone_) snprintf(errorMsg_, sizeof(errorMsg_), "Unexpected end of compressed input file %s", &name_[0]);
+      break;
+    }
+
+    if (format_ == GZIP) {
+      z_stream *zs = static_cast<z_stream*>(decoder_);
+
+      if (frameDone_) {
+        // another member follows
+        inflateReset(zs);
+        frameDone_ = false;
+      }
+
+      zs->next_in = reinterpret_cast<Bytef*>(&in_[inPos_]);
+      zs->avail_in = static_cast<uInt>(inEnd_ - inPos_);
+      zs->next_out = reinterpret_cast<Bytef*>(out + got);
+      zs->avail_out = static_cast<uInt>(n - got);
+
+      const int result = inflate(zs, Z_NO_FLUSH);
+
+      inPos_ = inEnd_ - zs->avail_in;
+      got = n - zs->avail_out;
+
+      if (result == Z_STREAM_END) {
+        frameDone_ = true;
+      }
+      else if (result != Z_OK && result != Z_BUF_ERROR) {
+        snprintf(errorMsg_, sizeof(errorMsg_), "Corrupt compressed input file %s", &name_[0]);
+        break;
+      }
+    }
+#ifdef GIGAL_ZSTD
+    else {
+      ZSTD_inBuffer in = { &in_[0], inEnd_, inPos_ };
+      ZSTD_outBuffer o = { out, n, got };
+
+      const size_t result = ZSTD_decompressStream(static_cast<ZSTD_DCtx*>(decoder_), &o, &in);
+
+      if (ZSTD_isError(result)) {
+        snprintf(errorMsg_, sizeof(errorMsg_), "Corrupt compressed input file %s: %s", &name_[0], ZSTD_getErrorName(result));
+        break;
+      }
+
+      inPos_ = in.pos;
+      got = o.pos;
+      frameDone_ = result == 0;
+    }
+#endif
+  }
+
+  return got;
+}
+
+void DataSource::startThread(const unsigned long long offset) {
+  fseeko(f_, static_cast<off_t>(offset), SEEK_SET);
+  if (format_ != PLAIN) initDecoder();
+
+  head_ = full_ = 0;
+  decoded_ = stop_ = false;
+  errorMsg_[0] = '\0';
+  block_ = NULL;
+  blockPos_ = blockEnd_ = 0;
+  fromRing_ = false;
+  servingKept_ = false;
+
+  if (pthread_create(&thread_, NULL, threadMain, this) != 0) error("Cannot create input thread");
+
+  running_ = true;
+}
+
+void DataSource::stopThread() {
+  pthread_mutex_lock(&mutex_);
+  stop_ = true;
+  pthread_cond_signal(&emptied_);
+  pthread_mutex_unlock(&mutex_);
+
+  pthread_join(thread_, NULL);
+  running_ = false;
+
+  head_ = full_ = 0;
+  block_ = NULL;
+  blockPos_ = blockEnd_ = 0;
+  fromRing_ = false;
+}
+
+void *DataSource::threadMain(void *arg) {
+  static_cast<DataSource*>(arg)->decodeLoop();
+  return NULL;
+}
+
+void DataSource::decodeLoop() {
+  while (true) {
+    pthread_mutex_lock(&mutex_);
+    while (full_ == ring_.size() && !stop_) pthread_cond_wait(&emptied_, &mutex_);
+
+    if (stop_) {
+      pthread_mutex_unlock(&mutex_);
+      return;
+    }
+
+    const unsigned int tail = (head_ + full_) % ring_.size();  // blocks beyond those that are full are not being read
+    pthread_mutex_unlock(&mutex_);
+
+    const size_t n = decode(ring_[tail], ringBlockBytes_);
+
+    pthread_mutex_lock(&mutex_);
+    if (n != 0) {
+      blockSize_[tail] = n;
+      full_++;
+    }
+    if (n < ringBlockBytes_) decoded_ = true;
+    pthread_cond_signal(&filled_);
+    pthread_mutex_unlock(&mutex_);
+
+    if (n < ringBlockBytes_) return;
+  }
+}
+
+bool DataSource::nextBlock() {
+  if (servingKept_) {
+    if (nextKept_ >= kept_.size()) return false;
+
+    const std::vector<char> &b = *kept_[nextKept_++];
+    block_ = &b[0];
+    blockPos_ = 0;
+    blockEnd_ = b.size();
+
+    return true;
+  }
+
+  pthread_mutex_lock(&mutex_);
+
+  if (fromRing_) {
+    head_ = (head_ + 1) % ring_.size();
+    full_--;
+    fromRing_ = false;
+    pthread_cond_signal(&emptied_);
+  }
+
+  if (full_ == 0 && !decoded_) {
+    const double start = now();
+    while (full_ == 0 && !decoded_) pthread_cond_wait(&filled_, &mutex_);
+    stallTime_ += now() - start;
+  }
+
+  if (full_ == 0) {
+    pthread_mutex_unlock(&mutex_);
+
+    if (errorMsg_[0] != '\0') error("%s", errorMsg_);
+
+    block_ = NULL;
+    blockPos_ = blockEnd_ = 0;
+
+    // the whole of the decoded data has been kept if keeping was not abandoned during the pass
+    if (keeping_) {
+      allKept_ = true;
+      keeping_ = false;
+    }
+
+    return false;
+  }
+
+  block_ = ring_[head_];
+  blockPos_ = 0;
+  blockEnd_ = blockSize_[head_];
+  fromRing_ = true;
+
+  pthread_mutex_unlock(&mutex_);
+
+  if (keeping_) {
+    if (keptBytes_ + blockEnd_ > keepLimit_) {
+      // the file is too large to keep, so later passes must restart the decoder
+      keeping_ = false;
+      keepLimit_ = 0;
+      dropDecoded();
+    }
+    else {
+      kept_.push_back(new std::vector<char>(block_, block_ + blockEnd_));
+      keptBytes_ += blockEnd_;
+    }
+  }
+
+  return true;
+}
+
+void DataSource::dropDecoded() {
+  kept_.clear();
+  keptBytes_ = 0;
+  allKept_ = false;
+}
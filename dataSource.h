@@ -0,0 +1,129 @@
+/* Open source system for classification learning from very large data
+** Class for reading the bytes of a data file that may be compressed
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "FILEtype.h"
+#include "utils.h"
+
+#include <pthread.h>
+#include <vector>
+
+/// The bytes of a data file.
+/// A gzip or zstd compressed file (recognised by its magic number) is decompressed on a background thread,
+/// which passes the decoded data to the reader through a ring of RING_BLOCKS blocks.
+/// If the whole of the decoded data fits within a limit (a quarter of physical memory) the blocks are kept
+/// during the first pass, and later passes are served from them rather than by restarting the decoder.
+/// With read-ahead, a plain file is read on a background thread into two READ_AHEAD_SIZE buffers in turn,
+/// so that the next buffer is read while the reader consumes the previous one.
+/// The time spent reading and the time the reader spends waiting for data are recorded so that it can be
+/// seen whether a run is limited by I/O.
+/// A pipe (the name "-" for the standard input, or a FIFO) is read as a plain file and cannot be rewound once read.
+class DataSource
+{
+public:
+  typedef enum {PLAIN, GZIP, ZSTD} Format;
+
+  DataSource();
+  ~DataSource(void);
+
+  static Format detect(const char *fileName);   ///< the format of a file, determined from its first bytes.  A pipe is not examined and is taken to be plain.
+  static bool isStream(const char *fileName);   ///< true iff the file is a pipe, which can be read only once
+
+  void open(const char *fileName);              ///< open a file
+  void close();                                 ///< close the file, stopping the decoder
+  size_t read(char *buffer, const size_t n);    ///< read up to n bytes.  Fewer are returned only at the end of the file.
+  void rewind();                                ///< return to the start of the file
+  void seek(const unsigned long long offset);   ///< position the file at an offset in the decoded data
+  void setReadAhead(const bool readAhead);      ///< read plain files on a background thread
+
+  inline bool isOpen() const { return f_ != NULL; }           ///< true iff a file is open
+  inline bool isCompressed() const { return format_ != PLAIN; } ///< true iff the file is decompressed as it is read
+  inline bool isStream() const { return stream_; }            ///< true iff the file is a pipe
+  inline unsigned long long getPosition() const { return position_; }  ///< the offset in the decoded data of the next byte to read
+
+  unsigned long long getBytesRead();            ///< the number of bytes that have been read from the file
+  double getReadTime();                         ///< the number of seconds spent reading the file
+  inline double getStallTime() const { return stallTime_; }  ///< the number of seconds the reader has spent waiting for data
+
+  static const size_t BLOCK_SIZE = 1 << 20;     ///< the number of bytes in each decoded block
+  static const unsigned int RING_BLOCKS = 4;    ///< the number of blocks in the ring between the decoder and the reader
+  static const size_t READ_AHEAD_SIZE = 1 << 22;  ///< the number of bytes in each read-ahead buffer
+
+private:
+  void initDecoder();             ///< prepare the decoder to decompress from the start of the file
+  void endDecoder();              ///< release the decoder
+  size_t decode(char *out, const size_t n);  ///< decompress, or for a plain file read, up to n bytes.  Fewer are returned only at the end of the data.
+  size_t readFile(void *out, const size_t n); ///< read up to n bytes from the file, timing the read
+  void allocRing(const unsigned int noBlocks, const size_t blockBytes);  ///< allocate the blocks of the ring
+  void freeRing();                ///< release the blocks of the ring
+  void startThread(const unsigned long long offset);  ///< start the background thread from an offset (which must be 0 for a compressed file)
+  void stopThread();              ///< stop the decoder thread and empty the ring
+  static void *threadMain(void *arg);  ///< the entry point for the decoder thread
+  void decodeLoop();              ///< decompress blocks into the ring until the end of the data or until stopped
+  bool nextBlock();               ///< release the current block and make the next one current.  Return false at the end of the data.
+  void dropDecoded();             ///< discard the decoded blocks that have been kept
+
+  FILEtype *f_;                   ///< the data file
+  Format format_;                 ///< the format of the data file
+  bool stream_;                   ///< true iff the data file is a pipe
+  std::vector<char> name_;        ///< the name of the data file
+  unsigned long long position_;   ///< the offset in the decoded data of the next byte to read
+  bool readAhead_;                ///< true iff plain files are read on a background thread
+  bool threaded_;                 ///< true iff the file is read through the ring by a background thread
+  void *decoder_;                 ///< the decoder state (a z_stream or ZSTD_DCtx)
+  std::vector<char> in_;          ///< compressed input that has been read but not yet decoded
+  size_t inPos_;                  ///< the next byte of in_ to decode
+  size_t inEnd_;                  ///< the end of the data in in_
+  bool inEOF_;                    ///< true iff all of the compressed file has been read into in_
+  bool frameDone_;                ///< true iff the decoder is at the end of a gzip member or zstd frame
+
+  // the ring between the decoder thread and the reader
+  pthread_t thread_;              ///< the background thread
+  bool running_;                  ///< true iff the background thread has been started and not yet joined
+  pthread_mutex_t mutex_;         ///< protects the following members
+  pthread_cond_t filled_;         ///< signalled when the decoder fills a block or reaches the end of the data
+  pthread_cond_t emptied_;        ///< signalled when the reader releases a block or the decoder is to stop
+  std::vector<char*> ring_;       ///< the blocks of the ring, which are page aligned
+  size_t ringBlockBytes_;         ///< the size of each block of the ring
+  std::vector<size_t> blockSize_; ///< the number of bytes decoded into each block of the ring
+  unsigned int head_;             ///< the block of the ring being read
+  unsigned int full_;             ///< the number of blocks that have been decoded and not released, including the one being read
+  bool decoded_;                  ///< true iff the decoder has reached the end of the data
+  bool stop_;                     ///< true when the decoder thread should exit
+  char errorMsg_[256];            ///< a decoding error found by the decoder thread, empty if there is none
+  unsigned long long bytesRead_;  ///< the number of bytes read from the file
+  double readTime_;               ///< the number of seconds spent reading the file
+
+  // the block being read
+  const char *block_;             ///< the data of the current block.  NULL if there is none
+  size_t blockPos_;               ///< the next byte of the current block to read
+  size_t blockEnd_;               ///< the number of bytes in the current block
+  bool fromRing_;                 ///< true iff the current block is held in the ring
+  double stallTime_;              ///< the number of seconds the reader has spent waiting for data
+
+  // the decoded data kept for later passes
+  ptrVec<std::vector<char> > kept_;  ///< the decoded blocks of the file, in order
+  unsigned long long keptBytes_;  ///< the number of bytes in kept_
+  unsigned long long keepLimit_;  ///< the greatest number of decoded bytes that can be kept
+  bool keeping_;                  ///< true iff the blocks being read are being kept
+  bool allKept_;                  ///< true iff kept_ holds the whole of the decoded data
+  bool servingKept_;              ///< true iff the current pass is read from kept_ rather than from the decoder
+  unsigned int nextKept_;         ///< the next block of kept_ to read when serving a pass from it
+};
@@ -1,32 +1,38 @@
-/* Gigal: An open source system for classification learning from very large data
-** Copyright (C) 2012 Geoffrey I Webb
-**
-** This program is free software: you can redistribute it and/or modify
-** it under the terms of the GNU General Public License as published by
-** the Free Software Foundation, either version 3 of the License, or
-** (at your option) any later version.
-** 
-** This program is distributed in the hope that it will be useful,
-** but WITHOUT ANY WARRANTY; without even the implied warranty of
-** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
-** GNU General Public License for more details.
-** 
-** You should have received a copy of the GNU General Public License
-** along with this program. If not, see <http://www.gnu.org/licenses/>.
-**
-** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
-*/
-#pragma once
-
-#include "instanceStream.h"
-
-#include <vector>
-
-class discretiser
-{
-public:
-  discretiser(void);
-  ~discretiser(void);
-
-  virtual void discretise(std::vector<NumValue> &vals, const std::vector<CatValue> &classes, unsigned int noOfClasses, std::vector<NumValue> &cuts) = 0; // discretize Attribute att with values vals
-};
+/* Gigal: An open source system for classification learning from very large data
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "instanceStream.h"
+
+#include <vector>
+
+class discretiser
+{
+public:
+  discretiser(void);
+  ~discretiser(void);
+
+  virtual void discretise(std::vector<NumValue> &vals, const std::vector<CatValue> &classes, unsigned int noOfClasses, std::vector<NumValue> &cuts) = 0; // discretize Attribute att with values vals
+
+  // a discretiser that is streamed takes every value of its source in a single pass, rather than a sample
+  virtual bool isStreamed() const;                                    ///< true iff the discretiser is streamed
+  virtual void startStream(const unsigned int noOfAtts);              ///< prepare to take the values of noOfAtts numeric attributes
+  virtual void addValue(const NumericAttribute att, const NumValue v, const InstanceCount weight);  ///< take a value of an attribute that occurs weight times
+  virtual void streamedCuts(const NumericAttribute att, std::vector<NumValue> &cuts);  ///< find the cuts for an attribute from all the values it has taken
+};
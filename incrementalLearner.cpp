@@ -1,47 +1,80 @@
-/* Open source system for classification learning from very large data
-** Copyright (C) 2012 Geoffrey I Webb
-**
-** This program is free software: you can redistribute it and/or modify
-** it under the terms of the GNU General Public License as published by
-** the Free Software Foundation, either version 3 of the License, or
-** (at your option) any later version.
-** 
-** This program is distributed in the hope that it will be useful,
-** but WITHOUT ANY WARRANTY; without even the implied warranty of
-** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
-** GNU General Public License for more details.
-** 
-** You should have received a copy of the GNU General Public License
-** along with this program. If not, see <http://www.gnu.org/licenses/>.
-**
-** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
-*/
-#include "incrementalLearner.h"
-#include <assert.h>
-
-IncrementalLearner::IncrementalLearner()
-{
-}
-
-IncrementalLearner::~IncrementalLearner(void)
-{
-}
-
-/// train the classifier from an instance stream
-void IncrementalLearner::train(InstanceStream &is) {
-  instance inst(is);
-  
-  testCapabilities(is);
-  
-  reset(is);
-
-  while (!trainingIsFinished()) {
-    initialisePass();
-    is.rewind();
-    while (is.advance(inst)) {
-      train(inst);
-    }
-    finalisePass();
-  }
-}
-
+/* Open source system for classification learning from very large data
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "incrementalLearner.h"
+#include "globals.h"
+#include <assert.h>
+
+IncrementalLearner::IncrementalLearner()
+{
+}
+
+IncrementalLearner::~IncrementalLearner(void)
+{
+}
+
+/// train the classifier from an instance stream, taking the instances a batch at a time.
+/// With -threads, each batch is shared among the workers of a pool that lasts for the whole of training.
+/// A pass that the learner can perform from the counts the stream provides is not read.
+void IncrementalLearner::train(InstanceStream &is) {
+  InstanceBatch batch(is);
+  WorkerPool *pool = noThreads > 1 ? new WorkerPool(noThreads) : NULL;
+  
+  testCapabilities(is);
+  
+  reset(is);
+
+  while (!trainingIsFinished()) {
+    initialisePass();
+    if (!trainFromCounts(is, pool)) {
+      is.rewind();
+      // a batch that is not full ends the pass
+      unsigned int n;
+      do {
+        n = is.advance(batch, batch.capacity());
+        if (n != 0) {
+          if (pool != NULL) train(batch, *pool);
+          else train(batch);
+        }
+      } while (n == batch.capacity());
+    }
+    finalisePass();
+  }
+
+  delete pool;
+}
+
+/// train from each instance of a batch in turn
+void IncrementalLearner::train(const InstanceBatch &batch) {
+  instance inst;
+
+  for (unsigned int i = 0; i < batch.size(); i++) {
+    batch.getInstance(i, inst);
+    train(inst);
+  }
+}
+
+bool IncrementalLearner::trainFromCounts(InstanceStream &, WorkerPool *) {
+  return false;
+}
+
+/// train from the batch on the calling thread, for learners that do not share the work among threads
+void IncrementalLearner::train(const InstanceBatch &batch, WorkerPool &) {
+  train(batch);
+}
+
@@ -0,0 +1,105 @@
+/* Open source system for classification learning from very large data
+** Class for a batch of instances stored as a structure of arrays
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "instanceBatch.h"
+
+#include <limits>
+
+InstanceBatch::InstanceBatch() : noCatAtts_(0), noNumAtts_(0), catWidth_(sizeof(CatValue)), capacity_(0), size_(0) {
+}
+
+InstanceBatch::InstanceBatch(InstanceStream &is) {
+  init(is);
+}
+
+InstanceBatch::~InstanceBatch(void) {
+}
+
+void InstanceBatch::init(InstanceStream &is) {
+  noCatAtts_ = is.getNoCatAtts();
+  noNumAtts_ = is.getNoNumAtts();
+
+  unsigned int maxValues = 0;
+
+  for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+    if (is.getNoValues(a) > maxValues) maxValues = is.getNoValues(a);
+  }
+
+  if (maxValues <= 1U << 8) catWidth_ = 1;
+  else if (maxValues <= 1U << 16) catWidth_ = 2;
+  else catWidth_ = sizeof(CatValue);
+
+  const size_t instBytes = noCatAtts_ * catWidth_ + sizeof(CatValue) + noNumAtts_ * sizeof(NumValue);
+
+  capacity_ = MAX_BYTES / instBytes;
+  if (capacity_ > MAX_SIZE) capacity_ = MAX_SIZE;
+  if (capacity_ == 0) capacity_ = 1;
+
+  size_ = 0;
+  catVals_.resize(noCatAtts_ * capacity_ * catWidth_);
+  numVals_.resize(noNumAtts_ * capacity_);
+  classes_.resize(capacity_);
+  inst_.init(is);
+}
+
+template <typename T>
+void InstanceBatch::addCatVals(const instance &inst) {
+  for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+    assert(inst.getCatVal(a) <= std::numeric_limits<T>::max());
+    catCol<T>(a)[size_] = static_cast<T>(inst.getCatVal(a));
+  }
+}
+
+void InstanceBatch::add(const instance &inst) {
+  assert(size_ < capacity_);
+
+  switch (catWidth_) {
+  case 1: addCatVals<unsigned char>(inst); break;
+  case 2: addCatVals<unsigned short>(inst); break;
+  default: addCatVals<CatValue>(inst); break;
+  }
+
+  for (NumericAttribute a = 0; a < noNumAtts_; a++) {
+    numVals_[a * capacity_ + size_] = inst.getNumVal(a);
+  }
+
+  classes_[size_] = inst.getClass();
+
+  size_++;
+}
+
+void InstanceBatch::getInstance(const unsigned int i, instance &inst) const {
+  assert(i < size_);
+
+  inst.catVals.resize(noCatAtts_);
+  inst.numVals.resize(noNumAtts_);
+  inst.sparseLayout = NULL;
+  inst.nonZeroAtts.clear();
+  inst.nonZeroVals.clear();
+
+  for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+    inst.catVals[a] = getCatVal(i, a);
+  }
+
+  for (NumericAttribute a = 0; a < noNumAtts_; a++) {
+    inst.numVals[a] = numVals_[a * capacity_ + i];
+  }
+
+  inst.theClass = classes_[i];
+}
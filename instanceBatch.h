@@ -0,0 +1,101 @@
+/* Open source system for classification learning from very large data
+** Class for a batch of instances stored as a structure of arrays
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "instanceStream.h"
+
+#include <assert.h>
+#include <vector>
+
+/// A batch of instances from a stream, held as a column of values for each attribute and a column of classes.
+/// A learner that processes a batch one attribute at a time works through one column at a time, in a loop
+/// over the instances that the compiler can vectorise, rather than making a chain of virtual calls per instance.
+/// The number of instances a batch can hold is chosen so that it occupies about MAX_BYTES.
+///
+/// The categorical columns hold each value in the fewest bytes that the attributes of the stream allow:
+/// one byte when no attribute has more than 256 values, otherwise two bytes when none has more than 65536.
+/// A learner reads a column through getCatCol<T>() for the type T that matches getCatWidth(), so its
+/// batch loops are instantiated once for each width (see the switch in xyDist::update(const InstanceBatch&)).
+class InstanceBatch
+{
+public:
+  InstanceBatch();
+  InstanceBatch(InstanceStream &is);
+  ~InstanceBatch(void);
+
+  void init(InstanceStream &is);    ///< prepare the batch to hold instances from a stream
+
+  inline unsigned int size() const { return size_; }          ///< the number of instances in the batch
+  inline unsigned int capacity() const { return capacity_; }  ///< the greatest number of instances the batch can hold
+
+  inline unsigned int getCatWidth() const { return catWidth_; }  ///< the number of bytes holding each categorical value: 1, 2 or sizeof(CatValue)
+
+  /// the values of a categorical attribute for each instance, as type T, which must have getCatWidth() bytes
+  template <typename T>
+  inline const T *getCatCol(const CategoricalAttribute att) const {
+    assert(sizeof(T) == catWidth_);
+    return reinterpret_cast<const T*>(&catVals_[att * capacity_ * sizeof(T)]);
+  }
+
+  inline const NumValue *getNumCol(const NumericAttribute att) const { return &numVals_[att * capacity_]; }     ///< the values of a numeric attribute for each instance
+  inline const CatValue *getClasses() const { return &classes_[0]; }                                           ///< the class of each instance
+
+  inline CatValue getCatVal(const unsigned int i, const CategoricalAttribute att) const {
+    switch (catWidth_) {
+    case 1: return getCatCol<unsigned char>(att)[i];
+    case 2: return getCatCol<unsigned short>(att)[i];
+    default: return getCatCol<CatValue>(att)[i];
+    }
+  }
+  inline NumValue getNumVal(const unsigned int i, const NumericAttribute att) const { return numVals_[att * capacity_ + i]; }
+  inline CatValue getClass(const unsigned int i) const { return classes_[i]; }
+
+  void getInstance(const unsigned int i, instance &inst) const;  ///< copy instance i of the batch into inst
+
+  static const unsigned int MAX_SIZE = 256;     ///< the greatest number of instances in a batch
+  static const size_t MAX_BYTES = 1 << 20;      ///< the number of bytes a batch of fewer than MAX_SIZE instances may occupy
+
+  friend class InstanceStream;        // allow InstanceStreams to fill the batch
+  friend class InstanceStreamMemory;
+  friend class InstanceStreamTransform;
+
+private:
+  void add(const instance &inst);     ///< append an instance to the batch
+
+  /// the column of a categorical attribute, for filling the batch
+  template <typename T>
+  inline T *catCol(const CategoricalAttribute att) {
+    assert(sizeof(T) == catWidth_);
+    return reinterpret_cast<T*>(&catVals_[att * capacity_ * sizeof(T)]);
+  }
+
+  template <typename T>
+  void addCatVals(const instance &inst);  ///< store the categorical values of an instance in the columns of type T
+
+  unsigned int noCatAtts_;            ///< the number of categorical attributes
+  unsigned int noNumAtts_;            ///< the number of numeric attributes
+  unsigned int catWidth_;             ///< the number of bytes holding each categorical value
+  unsigned int capacity_;             ///< the greatest number of instances the batch can hold
+  unsigned int size_;                 ///< the number of instances in the batch
+  std::vector<unsigned char> catVals_;  ///< the column for each categorical attribute, each of capacity_ values of catWidth_ bytes
+  std::vector<NumValue> numVals_;     ///< the column for each numeric attribute, each of capacity_ values
+  std::vector<CatValue> classes_;     ///< the class of each instance
+  instance inst_;                     ///< receives each instance when the batch is filled one instance at a time
+};
@@ -0,0 +1,505 @@
+/* Open source system for classification learning from very large data
+** Class for a binary columnar cache of the instances in a data file
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "instanceCache.h"
+#include "utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+static const char CACHE_MAGIC[4] = {'G', 'B', 'I', 'N'};
+static const unsigned int CACHE_VERSION = 1;
+
+// FNV-1a hash of a string, including its terminator
+// seek to an offset in a file, which may be beyond 2GB where long is 32 bits
+static void seekFile(FILE *f, const unsigned long long offset, const int origin = SEEK_SET) {
+#ifdef _MSC_VER
+  _fseeki64(f, static_cast<__int64>(offset), origin);
+#else
+  fseeko(f, static_cast<off_t>(offset), origin);
+#endif
+}
+
+// the offset of the position in a file
+static unsigned long long tellFile(FILE *f) {
+#ifdef _MSC_VER
+  return _ftelli64(f);
+#else
+  return ftello(f);
+#endif
+}
+
+static void hashString(unsigned long long &h, const char *s) {
+  do {
+    h ^= static_cast<unsigned char>(*s);
+    h *= 1099511628211ULL;
+  } while (*s++ != '\0');
+}
+
+static void hashUInt(unsigned long long &h, const unsigned int v) {
+  char buf[16];
+  sprintf(buf, "%u", v);
+  hashString(h, buf);
+}
+
+// the temporary files of the caches being written.  error() ends the run with exit(), which does not close the caches, so
+// any that are still being written are removed at exit rather than left beside the data file.
+static std::vector<std::vector<char> > pendingFiles;
+
+static void removePendingFiles() {
+  for (std::vector<std::vector<char> >::const_iterator it = pendingFiles.begin(); it != pendingFiles.end(); it++) {
+    remove(&(*it)[0]);
+  }
+}
+
+static void addPendingFile(const std::vector<char> &name) {
+  static bool registered = false;
+
+  if (!registered) {
+    atexit(removePendingFiles);
+    registered = true;
+  }
+
+  pendingFiles.push_back(name);
+}
+
+static void dropPendingFile(const std::vector<char> &name) {
+  for (std::vector<std::vector<char> >::iterator it = pendingFiles.begin(); it != pendingFiles.end(); it++) {
+    if (strcmp(&(*it)[0], &name[0]) == 0) {
+      pendingFiles.erase(it);
+      return;
+    }
+  }
+}
+
+// the narrowest number of bytes that can hold the values 0..noValues-1
+static unsigned char widthFor(const unsigned int noValues) {
+  if (noValues <= 0x100) return 1;
+  if (noValues <= 0x10000) return 2;
+  return sizeof(CatValue);
+}
+
+InstanceCache::InstanceCache() : f_(NULL), reading_(false), writing_(false), spill_(false), dataStart_(0), count_(0), blockCount_(0), row_(0), read_(0)
+{
+}
+
+InstanceCache::~InstanceCache(void)
+{ close();
+}
+
+void InstanceCache::setLayout(InstanceStream::MetaData &meta) {
+  noCatAtts_ = meta.getNoCatAtts();
+  noNumAtts_ = meta.getNoNumAtts();
+
+  // the signature identifies the attributes and their values so that a cache is not used with different metadata
+  signature_ = 14695981039346656037ULL;
+  hashUInt(signature_, noCatAtts_);
+  hashUInt(signature_, noNumAtts_);
+  hashUInt(signature_, meta.areNamesCaseSensitive());
+
+  catWidth_.resize(noCatAtts_);
+
+  for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+    const unsigned int noValues = meta.getNoValues(a);
+
+    hashString(signature_, meta.getCatAttName(a));
+    hashUInt(signature_, noValues);
+    for (CatValue v = 0; v < noValues; v++) {
+      hashString(signature_, meta.getCatAttValName(a, v));
+    }
+
+    catWidth_[a] = widthFor(noValues);
+  }
+
+  hashString(signature_, meta.getClassAttName());
+  hashUInt(signature_, meta.getNoClasses());
+  for (CatValue y = 0; y < meta.getNoClasses(); y++) {
+    hashString(signature_, meta.getClassName(y));
+  }
+
+  classWidth_ = widthFor(meta.getNoClasses());
+
+  for (NumericAttribute a = 0; a < noNumAtts_; a++) {
+    hashString(signature_, meta.getNumAttName(a));
+  }
+
+  col_.resize(noCatAtts_ + 1 + noNumAtts_);
+}
+
+unsigned int InstanceCache::colWidth(const unsigned int c) const {
+  if (c < noCatAtts_) return catWidth_[c];
+  if (c == noCatAtts_) return classWidth_;
+  return sizeof(NumValue);
+}
+
+// the number of bytes used to store a column of a block of n instances, padded to keep the columns aligned
+size_t InstanceCache::colBytes(const unsigned int c, const unsigned int n) const {
+  return (static_cast<size_t>(n) * colWidth(c) + sizeof(CatValue) - 1) & ~(sizeof(CatValue) - 1);
+}
+
+// each column of a block of n instances is stored contiguously
+void InstanceCache::setColumns(const unsigned int n) {
+  char *p = &block_[0];
+
+  for (unsigned int c = 0; c < col_.size(); c++) {
+    col_[c] = p;
+    p += colBytes(c, n);
+  }
+}
+
+size_t InstanceCache::blockBytes(const unsigned int n) const {
+  size_t bytes = 0;
+
+  for (unsigned int c = 0; c < col_.size(); c++) {
+    bytes += colBytes(c, n);
+  }
+
+  return bytes;
+}
+
+// the header records the source file, the layout, the number of instances and the precision of each numeric attribute
+void InstanceCache::writeHeader() {
+  const unsigned int version = CACHE_VERSION;
+  const unsigned long long count = count_;
+
+  fwrite(CACHE_MAGIC, 1, sizeof(CACHE_MAGIC), f_);
+  fwrite(&version, sizeof(version), 1, f_);
+  fwrite(&signature_, sizeof(signature_), 1, f_);
+  fwrite(&sourceSize_, sizeof(sourceSize_), 1, f_);
+  fwrite(&sourceTime_, sizeof(sourceTime_), 1, f_);
+  fwrite(&noCatAtts_, sizeof(noCatAtts_), 1, f_);
+  fwrite(&noNumAtts_, sizeof(noNumAtts_), 1, f_);
+  fwrite(&count, sizeof(count), 1, f_);
+  if (noCatAtts_) fwrite(&catWidth_[0], 1, noCatAtts_, f_);
+  fwrite(&classWidth_, 1, 1, f_);
+  if (noNumAtts_) fwrite(&precision_[0], sizeof(unsigned int), noNumAtts_, f_);
+}
+
+bool InstanceCache::readHeader() {
+  char magic[sizeof(CACHE_MAGIC)];
+  unsigned int version;
+  unsigned long long signature;
+  unsigned long long sourceSize;
+  long long sourceTime;
+  unsigned int noCatAtts;
+  unsigned int noNumAtts;
+  unsigned long long count;
+
+  if (fread(magic, 1, sizeof(magic), f_) != sizeof(magic) || memcmp(magic, CACHE_MAGIC, sizeof(magic)) != 0) return false;
+  if (fread(&version, sizeof(version), 1, f_) != 1 || version != CACHE_VERSION) return false;
+  if (fread(&signature, sizeof(signature), 1, f_) != 1 || signature != signature_) return false;
+  if (fread(&sourceSize, sizeof(sourceSize), 1, f_) != 1 || sourceSize != sourceSize_) return false;
+  if (fread(&sourceTime, sizeof(sourceTime), 1, f_) != 1 || sourceTime != sourceTime_) return false;
+  if (fread(&noCatAtts, sizeof(noCatAtts), 1, f_) != 1 || noCatAtts != noCatAtts_) return false;
+  if (fread(&noNumAtts, sizeof(noNumAtts), 1, f_) != 1 || noNumAtts != noNumAtts_) return false;
+  if (fread(&count, sizeof(count), 1, f_) != 1) return false;
+
+  std::vector<unsigned char> widths(noCatAtts_ + 1);
+  if (fread(&widths[0], 1, noCatAtts_ + 1, f_) != noCatAtts_ + 1) return false;
+  for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+    if (widths[a] != catWidth_[a]) return false;
+  }
+  if (widths[noCatAtts_] != classWidth_) return false;
+
+  precision_.resize(noNumAtts_);
+  if (noNumAtts_ && fread(&precision_[0], sizeof(unsigned int), noNumAtts_, f_) != noNumAtts_) return false;
+
+  count_ = static_cast<InstanceCount>(count);
+
+  return true;
+}
+
+bool InstanceCache::openRead(const char *cacheName, const char *sourceName, InstanceStream::MetaData &meta) {
+  close();
+
+  struct stat buf;
+
+  if (stat(sourceName, &buf) != 0) return false;
+
+  sourceSize_ = buf.st_size;
+  sourceTime_ = buf.st_mtime;
+
+  setLayout(meta);
+
+  cacheName_.assign(cacheName, cacheName + strlen(cacheName) + 1);
+
+  f_ = fopen(cacheName, "rb");
+
+  if (f_ == NULL) return false;
+
+  if (!readHeader()) {
+    fclose(f_);
+    f_ = NULL;
+    return false;
+  }
+
+  dataStart_ = tellFile(f_);
+  reading_ = true;
+  rewind();
+
+  return true;
+}
+
+bool InstanceCache::openWrite(const char *cacheName, const char *sourceName, InstanceStream::MetaData &meta) {
+  close();
+
+  struct stat buf;
+
+  if (stat(sourceName, &buf) != 0) return false;
+
+  sourceSize_ = buf.st_size;
+  sourceTime_ = buf.st_mtime;
+
+  setLayout(meta);
+
+  cacheName_.assign(cacheName, cacheName + strlen(cacheName) + 1);
+  tmpName_.resize(cacheName_.size() + 4);
+  sprintf(&tmpName_[0], "%s.tmp", cacheName);
+
+  f_ = fopen(&tmpName_[0], "wb");
+
+  if (f_ == NULL) return false;
+
+  addPendingFile(tmpName_);
+
+  startWrite();
+
+  return true;
+}
+
+bool InstanceCache::openSpill(InstanceStream::MetaData &meta) {
+  close();
+
+  sourceSize_ = 0;
+  sourceTime_ = 0;
+
+  setLayout(meta);
+
+#ifdef _MSC_VER
+  f_ = tmpfile();
+  cacheName_.assign(1, '\0');
+#else
+  const char *dir = getenv("TMPDIR");
+
+  if (dir == NULL || *dir == '\0') dir = "/tmp";
+
+  cacheName_.resize(strlen(dir) + 20);
+  sprintf(&cacheName_[0], "%s/gigal-spill-XXXXXX", dir);
+
+  const int fd = mkstemp(&cacheName_[0]);
+
+  if (fd < 0) return false;
+
+  // the file is removed at once so that it does not outlast the process
+  unlink(&cacheName_[0]);
+
+  f_ = fdopen(fd, "w+b");
+
+  if (f_ == NULL) {
+    ::close(fd);
+    return false;
+  }
+#endif
+
+  if (f_ == NULL) return false;
+
+  spill_ = true;
+  startWrite();
+
+  return true;
+}
+
+void InstanceCache::startWrite() {
+  count_ = 0;
+  precision_.assign(noNumAtts_, 0);
+  writeHeader();
+
+  block_.resize(blockBytes(BLOCK_SIZE));
+  setColumns(BLOCK_SIZE);
+  blockCount_ = 0;
+  writing_ = true;
+}
+
+void InstanceCache::write(const instance &inst) {
+  assert(writing_);
+
+  for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+    const CatValue v = inst.getCatVal(a);
+
+    switch (catWidth_[a]) {
+      case 1: reinterpret_cast<unsigned char*>(col_[a])[blockCount_] = static_cast<unsigned char>(v); break;
+      case 2: reinterpret_cast<unsigned short*>(col_[a])[blockCount_] = static_cast<unsigned short>(v); break;
+      default: reinterpret_cast<CatValue*>(col_[a])[blockCount_] = v; break;
+    }
+  }
+
+  const CatValue y = inst.getClass();
+
+  switch (classWidth_) {
+    case 1: reinterpret_cast<unsigned char*>(col_[noCatAtts_])[blockCount_] = static_cast<unsigned char>(y); break;
+    case 2: reinterpret_cast<unsigned short*>(col_[noCatAtts_])[blockCount_] = static_cast<unsigned short>(y); break;
+    default: reinterpret_cast<CatValue*>(col_[noCatAtts_])[blockCount_] = y; break;
+  }
+
+  for (NumericAttribute a = 0; a < noNumAtts_; a++) {
+    reinterpret_cast<NumValue*>(col_[noCatAtts_+1+a])[blockCount_] = inst.getNumVal(a);
+  }
+
+  count_++;
+
+  if (++blockCount_ == BLOCK_SIZE) flushBlock();
+}
+
+void InstanceCache::flushBlock() {
+  if (blockCount_ == 0) return;
+
+  const unsigned int n = blockCount_;
+
+  fwrite(&n, sizeof(n), 1, f_);
+
+  for (unsigned int c = 0; c < col_.size(); c++) {
+    fwrite(col_[c], 1, colBytes(c, n), f_);
+  }
+
+  blockCount_ = 0;
+}
+
+void InstanceCache::commit(const std::vector<unsigned int> &precision) {
+  assert(writing_);
+
+  flushBlock();
+
+  precision_ = precision;
+
+  seekFile(f_, 0);
+  writeHeader();
+
+  if (spill_) {
+    // the spill is read from the file it was written to, starting at its end so that the pass is complete
+    dataStart_ = tellFile(f_);
+
+    if (fflush(f_) != 0 || ferror(f_) != 0) error("Cannot write the temporary file holding the instances read");
+
+    writing_ = false;
+    reading_ = true;
+    seekFile(f_, 0, SEEK_END);
+    blockCount_ = 0;
+    row_ = 0;
+    read_ = count_;
+
+    return;
+  }
+
+  const bool failed = ferror(f_) != 0;
+
+  fclose(f_);
+  f_ = NULL;
+  writing_ = false;
+  dropPendingFile(tmpName_);
+
+  if (failed || ::rename(&tmpName_[0], &cacheName_[0]) != 0) {
+    remove(&tmpName_[0]);
+  }
+}
+
+void InstanceCache::close() {
+  if (f_ != NULL) {
+    fclose(f_);
+    f_ = NULL;
+  }
+
+  if (writing_ && !spill_) {
+    // an incomplete cache must not be used
+    remove(&tmpName_[0]);
+    dropPendingFile(tmpName_);
+  }
+
+  reading_ = false;
+  writing_ = false;
+  spill_ = false;
+}
+
+void InstanceCache::rewind() {
+  assert(reading_);
+
+  seekFile(f_, dataStart_);
+  blockCount_ = 0;
+  row_ = 0;
+  read_ = 0;
+}
+
+bool InstanceCache::readBlock() {
+  unsigned int n;
+
+  if (fread(&n, sizeof(n), 1, f_) != 1) return false;
+
+  const size_t bytes = blockBytes(n);
+
+  block_.resize(bytes);
+
+  if (fread(&block_[0], 1, bytes, f_) != bytes) error("Instance cache %s is truncated", &cacheName_[0]);
+
+  setColumns(n);
+  blockCount_ = n;
+
+  return true;
+}
+
+bool InstanceCache::next() {
+  if (read_ == count_) return false;
+
+  if (++row_ >= blockCount_) {
+    if (!readBlock()) return false;
+    row_ = 0;
+  }
+
+  read_++;
+
+  return true;
+}
+
+// every block but the last holds BLOCK_SIZE instances so the block holding an instance can be found directly
+bool InstanceCache::seek(const InstanceCount inst) {
+  assert(reading_);
+
+  rewind();
+
+  if (inst > count_) {
+    seekFile(f_, 0, SEEK_END);
+    read_ = count_;
+    return false;
+  }
+
+  const InstanceCount block = inst / BLOCK_SIZE;
+
+  seekFile(f_, dataStart_ + block * (sizeof(unsigned int) + blockBytes(BLOCK_SIZE)));
+  read_ = block * BLOCK_SIZE;
+
+  while (read_ < inst) next();
+
+  return true;
+}
+
+bool InstanceCache::isAtEnd() {
+  return read_ == count_;
+}
@@ -0,0 +1,113 @@
+/* Open source system for classification learning from very large data
+** Class for a binary columnar cache of the instances in a data file
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "instanceStream.h"
+
+#include <stdio.h>
+#include <vector>
+
+/// A binary cache of the instances in a data file.
+/// The instances are stored in blocks of up to BLOCK_SIZE instances.  Within a block each categorical attribute
+/// (and the class) is stored as a column of the narrowest unsigned integer width that can hold all its values
+/// and each numeric attribute as a column of floats.
+/// The cache records the size and modification time of the file from which it was created and a signature of the
+/// metadata, and is only used while all of these are unchanged.
+/// A spill is an anonymous cache of a source that cannot be read again, such as a pipe.  It is written to a
+/// temporary file (in $TMPDIR, or /tmp) that is removed as soon as it is created, and once committed it is read
+/// from the same file, so it lasts only as long as it is open.
+class InstanceCache
+{
+public:
+  InstanceCache();
+  ~InstanceCache(void);
+
+  bool openRead(const char *cacheName, const char *sourceName, InstanceStream::MetaData &meta);  ///< open an existing cache for reading.  Return false if it does not exist or is out of date.
+  bool openWrite(const char *cacheName, const char *sourceName, InstanceStream::MetaData &meta); ///< start writing a new cache.  Return false if it cannot be created.
+  bool openSpill(InstanceStream::MetaData &meta);                       ///< start writing a spill.  Return false if it cannot be created.
+  void write(const instance &inst);                                     ///< append an instance to the cache being written
+  void commit(const std::vector<unsigned int> &precision);             ///< complete the cache being written, recording the precision of each numeric attribute.  A spill is then open for reading, positioned at its end.
+  void close();                                                         ///< close the cache, discarding it if it is being written and has not been committed
+
+  void rewind();                                                        ///< return to the first instance in the cache
+  bool next();                                                          ///< advance to the next instance in the cache.  Return true iff successful.
+  bool isAtEnd();                                                       ///< true if there are no more instances to read
+  bool seek(const InstanceCount inst);                                  ///< position the cache so that next() reads instance inst.  Return false iff the cache has fewer instances.
+
+  inline bool isReading() const { return reading_; }                    ///< true iff the cache is open for reading
+  inline bool isWriting() const { return writing_; }                    ///< true iff a cache is being written
+  inline InstanceCount size() const { return count_; }                  ///< the number of instances in the cache
+  inline const std::vector<unsigned int> &getPrecision() const { return precision_; } ///< the precision of each numeric attribute recorded in the cache
+
+  /// the value of a categorical attribute for the current instance
+  inline CatValue getCatVal(const CategoricalAttribute att) const { return getCol(att, catWidth_[att]); }
+  /// the class of the current instance
+  inline CatValue getClass() const { return getCol(noCatAtts_, classWidth_); }
+  /// the value of a numeric attribute for the current instance
+  inline NumValue getNumVal(const NumericAttribute att) const {
+    return reinterpret_cast<const NumValue*>(col_[noCatAtts_+1+att])[row_];
+  }
+
+  static const unsigned int BLOCK_SIZE = 65536;  ///< the maximum number of instances in a block
+
+private:
+  inline CatValue getCol(const unsigned int c, const unsigned char width) const {
+    switch (width) {
+      case 1: return reinterpret_cast<const unsigned char*>(col_[c])[row_];
+      case 2: return reinterpret_cast<const unsigned short*>(col_[c])[row_];
+      default: return reinterpret_cast<const CatValue*>(col_[c])[row_];
+    }
+  }
+
+  void setLayout(InstanceStream::MetaData &meta);   ///< set the column widths for a stream
+  void startWrite();                                ///< write the header and prepare to accumulate the first block
+  void writeHeader();                               ///< write the header at the start of the file
+  bool readHeader();                                ///< read and validate the header.  Return false if it does not match
+  void flushBlock();                                ///< write the block being accumulated
+  bool readBlock();                                 ///< read the next block.  Return false if there are no more
+  void setColumns(const unsigned int n);           ///< point the columns at the data for a block of n instances
+  unsigned int colWidth(const unsigned int c) const; ///< the number of bytes used to store a value of a column
+  size_t colBytes(const unsigned int c, const unsigned int n) const; ///< the number of bytes used to store a column of n values
+  size_t blockBytes(const unsigned int n) const;    ///< the number of bytes used to store a block of n instances
+
+  FILE *f_;                                 ///< the cache file
+  bool reading_;                            ///< true iff the cache is open for reading
+  bool writing_;                            ///< true iff the cache is being written
+  bool spill_;                              ///< true iff the cache is a spill
+  std::vector<char> tmpName_;               ///< the name under which a cache is written until it is committed
+  std::vector<char> cacheName_;             ///< the name of the cache file
+  unsigned long long dataStart_;            ///< the offset of the first block in the file
+
+  unsigned long long signature_;            ///< a hash of the metadata for the stream
+  unsigned long long sourceSize_;           ///< the size of the source file
+  long long sourceTime_;                    ///< the modification time of the source file
+  unsigned int noCatAtts_;                  ///< the number of categorical attributes
+  unsigned int noNumAtts_;                  ///< the number of numeric attributes
+  std::vector<unsigned char> catWidth_;     ///< the number of bytes used to store each categorical attribute
+  unsigned char classWidth_;                ///< the number of bytes used to store the class
+  std::vector<unsigned int> precision_;     ///< the precision of each numeric attribute
+  InstanceCount count_;                     ///< the number of instances in the cache
+
+  std::vector<char> block_;                 ///< the data for the current block
+  std::vector<char*> col_;                  ///< the start of each column within the current block
+  unsigned int blockCount_;                 ///< the number of instances in the current block
+  unsigned int row_;                        ///< the current instance within the current block
+  InstanceCount read_;                      ///< the number of instances read so far
+};
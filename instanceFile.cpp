@@ -1,968 +1,1899 @@
-/* Open source system for classification learning from very large data
-** Class for an instance stream read sequentially from a file
-** Copyright (C) 2012 Geoffrey I Webb
-**
-** This program is free software: you can redistribute it and/or modify
-** it under the terms of the GNU General Public License as published by
-** the Free Software Foundation, either version 3 of the License, or
-** (at your option) any later version.
-** 
-** This program is distributed in the hope that it will be useful,
-** but WITHOUT ANY WARRANTY; without even the implied warranty of
-** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
-** GNU General Public License for more details.
-** 
-** You should have received a copy of the GNU General Public License
-** along with this program. If not, see <http://www.gnu.org/licenses/>.
-**
-** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
-*/
-#include "instanceFile.h"
-#include "utils.h"
-#include "globals.h"
-#include <ctype.h>
-#include <sys/stat.h>
-
-InstanceFile::InstanceFile(const char* metaFileName, const char* dataFileName) : f(NULL)
-{ metaData_ = &metadata_;
-
-  // parse the metafile
-  metadata_.parse(metaFileName);
-  
-  // open the data file for reading
-  resetSource(dataFileName);
-}
-
-
-InstanceFile::~InstanceFile(void)
-{ fclose(f);
-}
-
-void InstanceFile::resetSource(const char* fn) {
-  if (f != NULL) fclose(f);
-
-  metadata_.filename = fn;
-  line = 0;
-  count_ = 0;
-
-  f = fopen(fn, "r");
-
-  if (f == NULL) error("Cannot open input file %s", fn);
-}
-
-void InstanceFile::rewind() {
-  ::rewind(f);
-  line = 0;
-  count_ = 0;
-}
-
-/// advance, discarding the next instance in the stream.  Return true iff successful.
-bool InstanceFile::advance() {
-  int c = getc(f);
-
-  // skip lines containing only non-printable characters
-  while (c <= ' ') {
-    if (c == EOF) return false;
-    c = getc(f);
-  }
-
-  line++;
-  while (c != '\n' && c != '\r' && c != EOF) {
-    c = getc(f);
-  }
-
-  return true;
-}
-
-bool InstanceFile::advance(instance &inst) {
-  if (metadata_.inputFormat_ == ioMetadata::gigal_FORMAT) {
-    int c = getc(f);
-
-    while (isspace(c)) {
-      if (c == '\n') line++;
-      c = getc(f);
-    }
-
-    ioMetadata::Attribute att = 0;
-
-    while (c != '\n' && c!= '\r' && c != EOF) {
-      if (att == metadata_.noOfAttributes()) {
-        error("More values than attributes on line %" LCFMT, line);
-      }
-
-      switch (metadata_.attTypes[att]) {
-        case CATEGORICAL:
-          //catVals[metadata_.internalAtt[att]] = metadata_.getVal(f, metadata_.colWidth[att], metadata_.attValNames[metadata_.internalAtt[att]], metadata_.attNames[att], c, line);
-          setCatVal(inst, metadata_.internalAtt[att], metadata_.readCatVal(f, att, c, line));
-          break;
-        case CLASS:
-          //theClass = metadata_.getVal(f, metadata_.colWidth[att], metadata_.classNames, metadata_.attNames[att], c, line);
-          setClass(inst, metadata_.readClass(f, c, line));
-          break;
-        case NUMERIC:
-          setNumVal(inst, metadata_.internalAtt[att], metadata_.readNum(f, metadata_.internalAtt[att], c));
-          break;
-      }
-
-      if (c == ',') c = getc(f);
-
-      while (c != '\n' && c != '\r' && isspace(c)) c = getc(f);
-
-      att++;
-    }
-
-    if (att < metadata_.noOfAttributes()) {
-      if (att) {
-        error("Fewer values than attributes on line %" LCFMT, line);
-      }
-
-      return false;
-    }
-  }
-  else {
-    // libSVM format input
-    int c = getc(f);
-
-
-    while (isspace(c)) {
-      if (c == '\n') line++;
-      c = getc(f);
-    }
-
-    if (c == EOF) {
-      return false;
-    }
-
-    setClass(inst, metadata_.readClass(f, c, line, ' '));
-
-    while (c == ' ') c = getc(f);
-
-    for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
-      setNumVal(inst, a, 0);
-    }
-
-    ioMetadata::Attribute att;
-
-    while (c != '\n' && c != EOF) {
-      att = 0;
-
-      if (c < '0' || c > '9') error("libSVM format error: encountered '%c' when expecting an Attribute index", c);
-      
-      // get the Attribute index
-      while (c >= '0' && c <= '9') {
-        att *= 10;
-        att += c - '0';
-        c = getc(f);
-      }
-
-      if (att == 0 || att > metadata_.noOfAttributes()) {
-        error("Attribute index %d out of range on line %" LCFMT, att, line);
-      }
-
-      att--;    // indexes start from 1, internal indexes start fro m0
-
-      if (c != ':') {
-        error("Missing : following Attribute index %d on line %" LCFMT, att, line);
-      }
-      
-      c = getc(f);
-
-      setNumVal(inst, att, metadata_.readNum(f, att, c));
-
-      while (c == ' ') c = getc(f);
-    }
-  }
-
-  line++;
-
-  return true;
-}
-
-// check whether there is any more input in the file
-bool InstanceFile::isAtEnd() {
-  int c = fgetc(f);
-
-  while (isspace(c)) c = fgetc(f);
-
-  if (c == EOF) return true;
-  
-  ungetc(c, f);
-  
-  return false;
-}
-
-/// scan the file to count the number of instances it contains.
-/// if a count file exists (a file whith the file's filename + ".cnt") and is more recet than the file, read the count from the count file instead.
-InstanceCount InstanceFile::size() {
-  if (isAtEnd()) return count_; // if we have completed a pass through the data we can simply return the count
-
-  const bool update = false;  // allow future support for saving file counts
-
-  char *cntfname;
-  safeAlloc(cntfname, strlen(metadata_.filename) + 5);
-
-  sprintf(cntfname, "%s%s", metadata_.filename, ".cnt");
-
-  struct stat buf;
-
-  int result;
-   
-  // Get data associated with cnt file: 
-  result = stat( cntfname, &buf );
-
-  // Check if the cnt file exists 
-  if( result == 0 ) {
-      struct stat buf2;
-
-    // Get data associated with fname: 
-    result = stat( metadata_.filename, &buf2 );
-
-    // Check if the file exists 
-    if( result == 0 ) {
-      // check whether the cnt file is more recent
-      if (buf.st_mtime > buf2.st_mtime) {
-        InstanceCount cnt = 0;
-
-        FILE *f = fopen(cntfname, "r");
-
-        if (f != NULL) {
-          (void)fscanf(f, "%" ICFMT, &cnt);
-          fclose(f);
-          delete []cntfname;
-          return cnt;
-        }
-      }
-    }
-  }
-
-  FILE *f = fopen(metadata_.filename, "r");
-
-  int c = getc(f);
-  InstanceCount cnt = 0;
-
-  while (c != EOF) {
-    // skip lines containing only non-printable characters
-    while (c <= ' ') {
-      if (c == EOF) goto exitloop;
-      c = getc(f);
-    }
-
-    cnt++;
-    while (c != '\n' && c != '\r' && c != EOF) {
-      c = getc(f);
-    }
-exitloop:;
-  }
-
-  fclose(f);
-
-  if (update) {
-    FILE *f = fopen(cntfname, "w");
-    fprintf(f, "%" ICFMT "\n", cnt);
-  }
-
-  delete []cntfname;
-  
-  return cnt;
-}
-
-InstanceFile::ioMetadata::~ioMetadata(void)
-{
-  for (Attribute a = 0; a < noOfAttributes(); a++) {
-    delete []attNames[a];
-  }
-
-  for (CategoricalAttribute a = 0; a < attValNames.size(); a++) {
-    for (CatValue v = 0; v < attValNames[a].size(); v++) {
-      delete []attValNames[a][v];
-    }
-  }
-
-  for (CatValue v = 0; v < classNames_.size(); v++) {
-    delete []classNames_[v];
-  }
-}
-
-const char* InstanceFile::ioMetadata::getName() {
-  return filename;
-}
-
-///< true iff name comparisons are case sensitive
-bool InstanceFile::ioMetadata::areNamesCaseSensitive() {
-  return caseSensitive;
-}
-
-/// return the name for a class
-const char* InstanceFile::ioMetadata::getClassName(CatValue att) const {
-  return classNames_[att];
-}
-
-/// return the name for the class attribute
-const char* InstanceFile::ioMetadata::getClassAttName() const {
-  return attNames[class2io];
-}
-
-unsigned int InstanceFile::ioMetadata::getNoClasses() const {
-  return classNames_.size();
-}
-
-unsigned int InstanceFile::ioMetadata::getNoCatAtts() const {
-  return attValNames.size();
-}
-
-unsigned int InstanceFile::ioMetadata::getNoValues(CategoricalAttribute att) const {
-  assert(att < attValNames.size());
-  return attValNames[att].size();
-}
-
-const char* InstanceFile::ioMetadata::getCatAttName(CategoricalAttribute att) const {
-  return attNames[cat2io[att]];
-}
-
-const char* InstanceFile::ioMetadata::getCatAttValName(CategoricalAttribute att, CatValue val) const {
-  return attValNames[att][val];
-}
-
-unsigned int InstanceFile::ioMetadata::getNoNumAtts() const {
-  return num2io.size();
-}
-
-const char* InstanceFile::ioMetadata::getNumAttName(NumericAttribute att) const {
-  return attNames[num2io[att]];
-}
-
-/// return the precision to which values of a numeric attribute should be output
-unsigned int InstanceFile::ioMetadata::getPrecision(NumericAttribute att) const {
-  return precision[att];
-}
-
-/// return whether a categorical attribute contains missing values
-int InstanceFile::ioMetadata::hasCatMissing(CategoricalAttribute att) const {
-  return missingVals[cat2io[att]];
-}
-
-/// return whether a numeric attribute contains missing values
-int InstanceFile::ioMetadata::hasNumMissing(NumericAttribute att) const {
-  return missingVals[num2io[att]];
-}
-
-InstanceFile::ioMetadata::ioMetadata(const bool case_sensitive) : caseSensitive(case_sensitive)
-{
-}
-
-void InstanceFile::ioMetadata::setAllAttsMissing(){
-  missingVals.assign(missingVals.size(),1);
-}
-
-// reads a string terminated by EOF, \n or the nominated terminator
-// names are truncated at maxNameLength
-void InstanceFile::ioMetadata::readName(FILEtype *f, char *buffer, const char terminator, int &c) const {
-  int i = 0;
-  
-  while (true) {
-    if (c < ' ' || c == EOF || c == terminator) {
-      while (i > 0 && isspace(buffer[i-1])) i--;  // strip trailing spaces
-      buffer[i] = '\0';
-      return;
-    }
-
-    if (c >= ' ' && i < MAX_NAME_LENGTH) {  // truncate names at maxNameLength, discard non printing characters
-      buffer[i++] = static_cast<char>(c);
-    }
-
-    c = getc(f);
-  }
-}
-
-// reads a fixed width string
-// names are truncated at maxNameLength
-void InstanceFile::ioMetadata::readFWName(FILEtype *f, char *buffer, const unsigned int width, int &c) const {
-  unsigned int i = 0;
-  
-  while (true) {
-    if (c == '\n' || c == '\r' || c == EOF || i >= width) {
-      while (i > 0 && isspace(buffer[i-1])) i--;  // strip trailing spaces
-      buffer[i] = '\0';
-      return;
-    }
-
-    if (i < MAX_NAME_LENGTH) {  // truncate names at maxNameLength
-      buffer[i++] = static_cast<char>(c);
-    }
-
-    c = getc(f);
-  }
-}
-
-// parse a metadata file
-// The format is
-//   <line> ::= [ : <qualifier> { , <qualifier> } : ] <name> : numeric \n
-//            | [ : <qualifier> { , <qualifier> } : ] <name> : <name> { , <name> } \n
-//            | :: <comment> \n
-//   <qualifier> ::= width=<unsigned int>
-//                 | index=<unsigned int>-<unsigned int>
-//                 | class
-void InstanceFile::ioMetadata::parse(const char *fn) {
-  FILEtype *f;
-  int c;
-  char buffer[MAX_NAME_LENGTH+1];
-  LineCount line = 1;
-  bool classDeclaredBySpecifier = false;
-  bool classDeclared = false;
-  unsigned int noNumAtts = 0;
-  unsigned int noCatAtts = 0;
-  unsigned int noAttributes = 0;      ///< the total number of attributes (including the class)
-
-  f = fopen(fn, "r");
-
-  if (f == NULL) {
-    error("Cannot open metadata file '%s'", fn);
-  }
-
-  if (verbosity >= 1) printf("Loading metadata file %s\n", fn);
-
-  noAttributes  = 0;
-  colWidth.clear();
-  precision.clear();
-  attTypes.clear();
-  attNames.clear();
-  attValNames.clear();
-
-  inputFormat_ = gigal_FORMAT;
-
-  c = getc(f);
-
-  while (c != EOF) {
-    bool classAtt = false;
-    unsigned int width = 0;
-    bool indexed = false;
-    int startIndex = 0;
-    int endIndex = 0;
-
-    while (isspace(c)) {
-      if (c == '\n') line++;
-      c = getc(f);
-    }
-
-    if (c == EOF) break;
-
-    readName(f, buffer, ':', c);
-
-    if (c != ':') {
-      error("Missing colon on line %" LCFMT, line);
-    }
-
-    if (buffer[0] == '\0') {
-      // this means that the first character was ':'
-      // get qualifiers
-
-      c = getc(f);
-
-      readName(f, buffer, ':', c);
-
-      if (buffer[0] == '\0') {
-        // comment
-        while (c != '\n' && c != '\r' && c != EOF) {
-          c = getc(f);
-        }
-        continue;
-      }
-
-      if (streq(buffer, "libsvm")) {
-        // libsvm format
-        if (noAttributes)  error("Cannot combine libsvm declaration with attribute declarations");
-        if (c != ':') error("Expect : after libsvm qualifier");
-
-        c = getc(f);                // advance past the last terminator
-        readName(f, buffer, ':', c); // get the number of attributes
-
-        if (buffer[0] == '\0') error("Missing number of attributes after libsvm qualifier");
-        if (c != '\n' && c != '\r') error("Unexpected elements following number of elements");
-
-        int i = 0;
-
-        while (buffer[i] >= '0' && buffer[i] <= '9') {
-          noNumAtts *= 10;
-          noNumAtts += buffer[i] - '0';
-          i++;
-        }
-
-        // make the required number of copies
-        const int indexLen = printWidth(noNumAtts);
-        int nameLen = indexLen + 2;
-        if (nameLen > MAX_NAME_LENGTH) {
-          nameLen = MAX_NAME_LENGTH;
-        }
-
-        char *buf;
-
-        for (NumericAttribute i = 1; i <= noNumAtts; i++) {
-          safeAlloc(buf, nameLen+1);
-          sprintf(buf, "a_%d", i);
-          attNames.push_back(buf);
-          colWidth.push_back(0);
-          attTypes.push_back(NUMERIC);
-          internalAtt.push_back(noAttributes);
-          num2io.push_back(noAttributes++);
-          precision.push_back(0);
-          missingVals.push_back(0);
-        }
-
-        inputFormat_ = LIBSVM_FORMAT;
-
-        continue;
-      }
-
-      bool finished = false;
-      unsigned int i = 0;
-
-      while (!finished) {
-        // identify the next token
-        const unsigned int start = i;
-
-        while (buffer[i] != '\0' && buffer[i] != ',' && buffer[i] != '=') {
-          i++;
-        }
-
-        const char terminator = buffer[i];
-        buffer[i] = '\0';
-
-        if (streq(buffer+start, "class")) {
-          // this is the class attribute
-          if (terminator == '=') {
-            error("Unexpected = following class specifier on line %" LCFMT, line);
-          }
-          if (classDeclaredBySpecifier) {
-            error("Only one class can be specified. Second class specifier on line %" LCFMT, line);
-          }
-          classAtt = true;
-          classDeclaredBySpecifier = true;
-        }
-        else if (streq(buffer+start, "width")) {
-          // the field is fixed width
-          if (terminator != '=') {
-            error("Expected = following width specifier on line %" LCFMT, line);
-          }
-
-          i++;  // skip '='
-
-          while (buffer[i] >= '0' && buffer[i] <= '9') {
-            width *= 10;
-            width += buffer[i++] - '0';
-          }
-        }
-        else if (streq(buffer+start, "index")) {
-          // there are endIndex-startIndex+1 repetitions of an identical attribute
-          // they all share a common name indexed by the specified range of indices
-          if (terminator != '=') {
-            error("Expected = following index specifier on line %" LCFMT, line);
-          }
-
-          indexed = true;
-          i++;  // skip '='
-
-          while (buffer[i] >= '0' && buffer[i] <= '9') {
-            startIndex *= 10;
-            startIndex += buffer[i++] - '0';
-          }
-
-          if (buffer[i] != '-') {
-            error("Expected - following first index on line %" LCFMT, line);
-          }
-
-          i++;  // skip '-'
-
-          while (buffer[i] >= '0' && buffer[i] <= '9') {
-            endIndex *= 10;
-            endIndex += buffer[i++] - '0';
-          }
-        }
-        else {
-            error("Error in meta information on line %" LCFMT, line);
-        }
-
-        if (buffer[i] == '\0') {
-          finished = true;
-        }
-        else if (buffer[i] == ',') {
-          i++;
-        }
-        else {
-            error("Error in meta information on line %" LCFMT, line);
-        }
-      }
-
-      c = getc(f);                // advance past the last terminator
-      readName(f, buffer, ':', c); // get the attribute name
-    }
-
-
-    char *buf;
-
-    if (indexed) {
-      // make the required number of copies
-      int nameLen = strlen(buffer);
-      const int indexLen = printWidth(endIndex);
-      if (nameLen + indexLen >= MAX_NAME_LENGTH) {
-        nameLen = MAX_NAME_LENGTH - indexLen;
-      }
-
-      for (int i = startIndex; i <= endIndex; i++) {
-        safeAlloc(buf, strlen(buffer)+indexLen+2);
-        strcpy(buf, buffer);
-        sprintf(buf+nameLen, "_%d", i);
-        attNames.push_back(buf);
-        colWidth.push_back(width);
-      }
-    }
-    else {
-      safeAlloc(buf, strlen(buffer)+1);
-      strcpy(buf, buffer);
-      attNames.push_back(buf);
-      colWidth.push_back(width);
-    }
-
-    if (streq(buf, "class") && !classDeclaredBySpecifier) {
-      classAtt = true;
-    }
-
-    c = getc(f);
-
-    while (isspace(c)) {
-      c = getc(f);
-    }
-
-    if (c == EOF || c == '\n' || c == '\r') {
-      error("Missing attribute type on line %" LCFMT, line);
-    }
-
-    // get the first value or the type
-    readName(f, buffer, ',', c);
-
-    if (streq(buffer, "numeric")) {
-      //c = getc(f); 
-      int missing = 0;
-      if(c == ','){
-        c = getc(f);
-        assert (c == '?');
-        missing = 1;
-        c = getc(f);
-      }
-      for (int i = startIndex; i <= endIndex; i++) {
-        attTypes.push_back(NUMERIC);
-        internalAtt.push_back(noNumAtts++);
-        num2io.push_back(noAttributes++);
-        precision.push_back(0);
-        missingVals.push_back(missing);
-      }
-    }
-    else {
-      // must be a list of the allowed values for the attribute
-      std::vector<char *> valNames;
-
-      char *buf;
-      safeAlloc(buf, strlen(buffer)+1);
-      strcpy(buf, buffer);
-      valNames.push_back(buf);
-      
-      int missing = 0;
-      
-      if (streq(buffer,"?"))
-        missing = 1;
-
-      while (c != '\n' && c != '\r' && c != EOF) {
-        if (isspace(c)) {
-          c = getc(f);
-        }
-        else {
-          if (c != ',') {
-            error("Syntax eror on line %" LCFMT, line);
-          }
-          
-          c = getc(f);
-          while (isspace(c)) c = getc(f);
-          
-          readName(f, buffer, ',', c);
-          
-          for (std::vector<char *>::const_iterator it = valNames.begin(); it != valNames.end(); it++) {
-            if (streq(buffer, *it, caseSensitive)) {
-              error("Value '%s' declared twice for attribute '%s'", buffer, attNames.back());
-            }
-          }
-
-          safeAlloc(buf, strlen(buffer)+1);
-          strcpy(buf, buffer);
-          valNames.push_back(buf);
-          
-          if (streq(buffer,"?"))
-            missing = 1;
-        }
-      }
-
-      for (int i = startIndex; i <= endIndex; i++) {
-        if (classAtt) {
-          if (indexed) {
-            error("Class cannot be indexed");
-          }
-          attTypes.push_back(CLASS);
-          internalAtt.push_back(0);
-          classDeclared = true;
-          classNames_ = valNames;
-          class2io = noAttributes++;
-          missingVals.push_back(missing);
-        }
-        else {
-          attTypes.push_back(CATEGORICAL);
-          internalAtt.push_back(noCatAtts++);
-          cat2io.push_back(noAttributes++);
-
-          // need to duplicate the value names
-          if (i > startIndex) {
-            for (CatValue v = 0; v < valNames.size(); v++) {
-              char *buf;
-              safeAlloc(buf, strlen(valNames[v])+1);
-              strcpy(buf, valNames[v]);
-              valNames[v] = buf;
-            }
-          }
-          attValNames.push_back(valNames);
-          missingVals.push_back(missing);
-        }
-      }
-    }
-
-    if (c == '\n') {
-      line++;
-      c = getc(f);
-    }
-    else {
-      if (c != EOF) {
-        error("Syntax error on line %" LCFMT, line);
-      }
-    }
-  }
-
-  if (!classDeclared) {
-    error("No class declared in metadata file '%s'", fn);
-  }
-
-  fclose(f);
-
-  assert(noAttributes == noNumAtts + noCatAtts + 1);
-  assert(attTypes.size() == noAttributes);
-  assert(colWidth.size() == noAttributes);
-  assert(attNames.size() == noAttributes);
-  assert(precision.size() == noNumAtts);
-  assert(attValNames.size() == noCatAtts);
-  assert(internalAtt.size() == noAttributes);
-  assert(cat2io.size() == noCatAtts);
-  assert(num2io.size() == noNumAtts);
-  assert(missingVals.size() == noAttributes);
-}
-
-CatValue InstanceFile::ioMetadata::getVal(const char *valname, const std::vector<char *> &valNames, const char *attname) const {
-  unsigned int i = 0;
-
-  while (i < valNames.size()) {
-    if (streq(valname, valNames[i], caseSensitive)) {
-      return i;
-    }
-
-    i++;
-  }
-
-  error("'%s' is not a value for attribute '%s'", valname, attname);
-}
-
-CatValue InstanceFile::ioMetadata::readVal(FILEtype *f, const unsigned int colWidth, const std::vector<char *> &valNames, const char * attName, int &c, LineCount line, const char delimiter) const {
-  assert(noOfAttributes()>0); // check that the metadata has been parsed before it is used
-
-  char buffer[MAX_NAME_LENGTH+1];
-
-  if (colWidth) {
-    readFWName(f, buffer, colWidth, c);
-  }
-  else {
-    readName(f, buffer, delimiter, c);
-  }
-
-  unsigned int i = 0;
-
-  while (i < valNames.size()) {
-    if (streq(buffer, valNames[i], caseSensitive)) {
-      return i;
-    }
-
-    i++;
-  }
-
-  error("'%s' is not a value for attribute '%s' on line %" LCFMT, buffer, attName, line);
-}
-
-CatValue InstanceFile::ioMetadata::readClass(FILEtype *f, int &c, const LineCount line, const char delimiter) const {
-  return readVal(f, colWidth[class2io], classNames_, attNames[class2io], c, line, delimiter);
-}
-
-// get a signed floating point number
-NumValue InstanceFile::ioMetadata::readSimpleNum(FILEtype *f, int &c, unsigned int &charsRemaining, unsigned int &precision) const {
-  assert(noOfAttributes()>0); // check that the metadata has been parsed before it is used
-
-  bool sign = false;
-  double v = 0;
-
-  precision = 0;  // count the number of decimal places that are specified
-
-  if (c == '-') {
-    sign = true;
-    charsRemaining--;
-    c = getc(f);
-  }
-
-  while (c >= '0' && c <= '9' && charsRemaining != 0) {
-    v = 10 * v + c - '0';
-    charsRemaining--;
-    c = getc(f);
-  }
-
-  if (c == '.' && charsRemaining != 0) {
-    charsRemaining--;
-    c = getc(f);
-    double divisor = 10;
-
-    while (c >= '0' && c <= '9' && charsRemaining != 0) {
-      v += (c - '0') / divisor;
-      divisor *= 10;
-      charsRemaining--;
-      precision++;
-      c = getc(f);
-    }
-  }
-
-  if (sign) v = -v;
-
-  return static_cast<NumValue>(v);
-}
-
-// get a number for the specified attribute
-NumValue InstanceFile::ioMetadata::readNum(FILEtype *f, const NumericAttribute att, int &c) {
-  assert(noOfAttributes()>0); // check that the metadata has been parsed before it is used
-
-  if (c == '?') {
-    // missing value
-    c = getc(f);        // advance past character
-    return MISSINGNUM;  // return the missing value
-  }
-
-  unsigned int charsRemaining = colWidth[att];
-  unsigned int thisPrecision;
-
-  if (charsRemaining == 0) charsRemaining = std::numeric_limits<unsigned int>::max();
-
-  double v = readSimpleNum(f, c, charsRemaining, thisPrecision);
-
-  if (c == 'e' || c == 'E' && charsRemaining != 0) {
-    unsigned int ignore;
-
-    c = getc(f);
-    charsRemaining--;
-    double exponent = readSimpleNum(f, c, charsRemaining, ignore);
-
-    thisPrecision -= static_cast<unsigned int>(exponent);
-
-    v *= pow(10.0, exponent);
-  }
-
-  if (thisPrecision > precision[att]) precision[att] = thisPrecision;
-    
-  return static_cast<NumValue>(v);
-}
-
-#if 0
-bool instance::get(FILEtype *f, LineCount &line) {
-  if (metadata_.inputFormat == ifgigal) {
-    int c = getc(f);
-
-    while (c == ' ') c = getc(f);
-
-    Attribute att = 0;
-
-    while (c != '\n' && c != EOF) {
-      if (att == metadata_.noAttributes) {
-        error("More values than attributes on line %" LCFMT, line);
-      }
-
-      switch (metadata_.attTypes[att]) {
-        case categorical:
-          //catVals[metadata_.internalAtt[att]] = metadata_.getVal(f, metadata_.colWidth[att], metadata_.attValNames[metadata_.internalAtt[att]], metadata_.attNames[att], c, line);
-          catVals[metadata_.internalAtt[att]] = metadata_.getCatVal(f, att, c, line);
-          break;
-        case class_type:
-          //theClass = metadata_.getVal(f, metadata_.colWidth[att], metadata_.classNames, metadata_.attNames[att], c, line);
-          theClass = metadata_.getClass(f, c, line);
-          break;
-        case numeric:
-          numVals[metadata_.internalAtt[att]] = metadata_.getNum(f, metadata_.internalAtt[att], c, line);
-          break;
-      }
-
-      if (c == ',') c = getc(f);
-
-      while (c == ' ') c = getc(f);
-
-      att++;
-    }
-
-    if (att < metadata_.noAttributes) {
-      if (att) {
-        error("Fewer values than attributes on line %" LCFMT, line);
-      }
-      return false;
-    }
-  }
-  else {
-    // libSVM format input
-    int c = getc(f);
-
-    while (c == ' ') c = getc(f);
-
-    if (c == '\n' || c == EOF) return false;
-
-    theClass = metadata_.getClass(f, c, line, ' ');
-
-    while (c == ' ') c = getc(f);
-
-    numVals.assign(metadata_.noNumAtts, 0);
-
-    Attribute att;
-
-    while (c != '\n' && c != EOF) {
-      att = 0;
-
-      // get the Attribute index
-      while (c >= '0' && c <= '9') {
-        att *= 10;
-        att += c - '0';
-        c = getc(f);
-      }
-
-      if (att == 0 || att > metadata_.noAttributes) {
-        error("Attribute index %d out of range on line %" LCFMT, att, line);
-      }
-
-      att--;    // indexes start from 1, internal indexes start fro m0
-
-      if (c != ':') {
-        error("Missing : following Attribute index %d on line %" LCFMT, att, line);
-      }
-      
-      c = getc(f);
-
-      numVals[att] = metadata_.getNum(f, att, c, line);
-
-      while (c == ' ') c = getc(f);
-    }
-  }
-    
-  return true;
-}
-#endif
+/* Open source system for classification learning from very large data
+** Class for an instance stream read sequentially from a file
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "instanceFile.h"
+#include "utils.h"
+#include "globals.h"
+#include "mtrand.h"
+#include <algorithm>
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <string>
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+static const size_t INPUT_BUFFER_SIZE = 1 << 20;  ///< the initial size of the input buffer. It is grown as required to hold a whole line
+static const size_t PARSE_CHUNK_SIZE = 1 << 22;   ///< the number of bytes parsed by each thread in each window when parsing in parallel
+static const size_t MIN_PARSE_CHUNK_SIZE = 1 << 14;  ///< the number of bytes parsed by each thread in the first window after a rewind or seek.  Successive windows double in size up to PARSE_CHUNK_SIZE
+
+InstanceFile::ParseError::ParseError(const char *fmt, ...) {
+  va_list v_args;
+  va_start(v_args, fmt);
+  vsnprintf(msg, sizeof(msg), fmt, v_args);
+  va_end(v_args);
+}
+
+InstanceFile::InstanceFile(const char* metaFileName, const char* dataFileName)
+  : memoryMapped_(false), mapped_(false), map_(NULL), mapSize_(0), pos_(NULL), end_(NULL), atEOF_(false), caching_(false), streaming_(false), pool_(NULL), chunk_(0), next_(0), chunkSize_(MIN_PARSE_CHUNK_SIZE)
+{ metaData_ = &metadata_;
+
+  // parse the metafile
+  metadata_.parse(metaFileName);
+  
+  // open the data file for reading
+  resetSource(dataFileName);
+}
+
+
+InstanceFile::~InstanceFile(void)
+{ closeSource();
+  delete pool_;
+}
+
+void InstanceFile::resetSource(const char* fn) {
+  closeSource();
+  index_ = InstanceIndex();
+
+  metadata_.filename = fn;
+  line = 0;
+
+  openSource();
+  startCache();
+}
+
+/// read the data file through a memory mapping rather than through buffered reads
+void InstanceFile::setMemoryMapped(const bool mapped) {
+  if (mapped == memoryMapped_) return;
+
+  // a pipe cannot be mapped, nor reopened
+  if (streaming_) {
+    memoryMapped_ = mapped;
+    return;
+  }
+
+  closeSource();
+  memoryMapped_ = mapped;
+  line = 0;
+  openSource();
+  startCache();
+}
+
+/// serve passes after the first from a binary cache written during the first pass
+void InstanceFile::setCaching(const bool caching) {
+  caching_ = caching;
+
+  // the spill of a pipe holds instances that cannot be read again
+  if (streaming_) return;
+
+  cache_.close();
+  rewind();   // starts the cache, if required, from the first instance
+}
+
+/// parse the data file in chunks on n threads
+void InstanceFile::setThreads(const unsigned int n) {
+  delete pool_;
+  pool_ = NULL;
+  chunks_.clear();
+
+  if (n > 1) {
+    pool_ = new WorkerPool(n);
+    chunks_.resize(n);
+  }
+
+  rewind();
+}
+
+/// read the data file on a background thread while it is parsed
+void InstanceFile::setReadAhead(const bool readAhead) {
+  source_.setReadAhead(readAhead);
+}
+
+/// print the amount of data read, the read rate and the time spent waiting for data, from which it can be seen whether a run is I/O bound
+void InstanceFile::printIOStats() {
+  if (mapped_) {
+    printf("Input: %s is memory mapped\n", metadata_.filename);
+    return;
+  }
+
+  const double mb = source_.getBytesRead() / (1024.0 * 1024.0);
+  const double seconds = source_.getReadTime();
+
+  printf("Input: %.1f MB read in %.2f seconds (%.1f MB/s), parsing stalled for %.2f seconds waiting for data\n",
+         mb, seconds, seconds > 0 ? mb / seconds : 0.0, source_.getStallTime());
+}
+
+void InstanceFile::startCache() {
+  cache_.close();
+
+  if (streaming_) {
+    if (!cache_.openSpill(metadata_)) error("Cannot create a temporary file to hold the instances of %s", metadata_.filename);
+    cacheInst_.init(*this);
+    return;
+  }
+
+  if (!caching_) return;
+
+  std::vector<char> cacheName(strlen(metadata_.filename) + 6);
+  sprintf(&cacheName[0], "%s.gbin", metadata_.filename);
+
+  if (cache_.openRead(&cacheName[0], metadata_.filename, metadata_)) {
+    metadata_.precision = cache_.getPrecision();
+    if (verbosity >= 2) printf("Reading instances from cache %s\n", &cacheName[0]);
+  }
+  else if (cache_.openWrite(&cacheName[0], metadata_.filename, metadata_)) {
+    cacheInst_.init(*this);
+  }
+  else if (verbosity >= 2) {
+    printf("Cannot create cache %s\n", &cacheName[0]);
+  }
+}
+
+void InstanceFile::openSource() {
+  const char *fn = metadata_.filename;
+
+  streaming_ = DataSource::isStream(fn);
+
+  // a compressed file is read through the decompressor even if memory mapping is requested
+  mapped_ = memoryMapped_ && !streaming_ && DataSource::detect(fn) == DataSource::PLAIN;
+
+  if (mapped_) {
+#ifdef _MSC_VER
+    error("Memory mapped input is not supported on this platform");
+#else
+    const int fd = open(fn, O_RDONLY);
+
+    if (fd < 0) error("Cannot open input file %s", fn);
+
+    struct stat buf;
+
+    if (fstat(fd, &buf) != 0) error("Cannot determine the size of input file %s", fn);
+
+    mapSize_ = buf.st_size;
+
+    if (mapSize_ != 0) {  // an empty file cannot be mapped
+      void *m = mmap(NULL, mapSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      if (m == MAP_FAILED) error("Cannot memory map input file %s", fn);
+
+      map_ = static_cast<char*>(m);
+      madvise(map_, mapSize_, MADV_SEQUENTIAL);
+    }
+
+    close(fd);
+
+    pos_ = map_;
+    end_ = map_ + mapSize_;
+    atEOF_ = true;
+#endif
+  }
+  else {
+    source_.open(fn);
+
+    if (source_.isCompressed() && verbosity >= 2) printf("Decompressing %s\n", fn);
+
+    buffer_.resize(INPUT_BUFFER_SIZE);
+    pos_ = end_ = &buffer_[0];
+    atEOF_ = false;
+  }
+}
+
+void InstanceFile::closeSource() {
+  source_.close();
+
+#ifndef _MSC_VER
+  if (map_ != NULL) {
+    munmap(map_, mapSize_);
+    map_ = NULL;
+  }
+#endif
+
+  mapSize_ = 0;
+  pos_ = end_ = NULL;
+}
+
+// move the unread data to the start of the buffer and read as much of the file as will fit after it
+bool InstanceFile::fill() {
+  if (atEOF_) return false;
+
+  const size_t remaining = end_ - pos_;
+
+  if (remaining == buffer_.size()) {
+    // the buffer is full of unread data so must grow
+    const size_t offset = pos_ - &buffer_[0];
+    buffer_.resize(2 * buffer_.size());
+    pos_ = &buffer_[0] + offset;
+  }
+
+  char *start = &buffer_[0];
+
+  if (remaining != 0 && pos_ != start) memmove(start, pos_, remaining);
+
+  const size_t wanted = buffer_.size() - remaining;
+  const size_t got = source_.read(start + remaining, wanted);
+
+  if (got < wanted) atEOF_ = true;
+
+  pos_ = start;
+  end_ = start + remaining + got;
+
+  return got != 0;
+}
+
+// read until the buffer holds a line terminator or the end of the file
+void InstanceFile::bufferRecord() {
+  size_t scanned = 0;
+
+  while (!atEOF_ && memchr(pos_ + scanned, '\n', (end_ - pos_) - scanned) == NULL) {
+    scanned = end_ - pos_;
+    fill();
+  }
+}
+
+void InstanceFile::spillRest() {
+  while (advance(cacheInst_)) {}
+}
+
+void InstanceFile::rewind() {
+  if (streaming_ && cache_.isWriting()) {
+    // nothing has been read from the pipe, so the first pass is still at its start
+    if (cache_.size() == 0) return;
+
+    spillRest();
+  }
+
+  if (cache_.isReading()) {
+    cache_.rewind();
+  }
+  else if (caching_) {
+    // a cache that was not completed in the last pass must be started again
+    startCache();
+  }
+
+  if (mapped_) {
+    pos_ = map_;
+  }
+  else if (!streaming_) {
+    source_.rewind();
+    pos_ = end_ = &buffer_[0];
+    atEOF_ = false;
+  }
+  line = 0;
+
+  // discard any instances that have been parsed in parallel
+  chunk_ = chunks_.size();
+  next_ = 0;
+  chunkSize_ = MIN_PARSE_CHUNK_SIZE;
+}
+
+/// advance, discarding the next instance in the stream.  Return true iff successful.
+bool InstanceFile::advance() {
+  if (cache_.isReading()) return cache_.next();
+
+  // instances that are skipped must still be parsed to be written to the cache
+  if (cache_.isWriting()) return advance(cacheInst_);
+
+  if (pool_ != NULL) return readParsed(NULL);
+
+  return skipLine();
+}
+
+/// skip the next line of the data file without parsing it.  Return true iff successful.
+bool InstanceFile::skipLine() {
+  // skip lines containing only non-printable characters
+  while (more() && static_cast<unsigned char>(*pos_) <= ' ') pos_++;
+
+  if (pos_ == end_) return false;
+
+  line++;
+
+  // skip to the end of the line, consuming the terminator
+  do {
+    const char *p = pos_;
+
+    while (p < end_ && *p != '\n' && *p != '\r') p++;
+
+    pos_ = p;
+
+    if (p < end_) {
+      pos_++;
+      break;
+    }
+  } while (fill());
+
+  return true;
+}
+
+bool InstanceFile::advance(instance &inst) {
+  if (cache_.isReading()) {
+    if (!cache_.next()) return false;
+
+    for (CategoricalAttribute a = 0; a < getNoCatAtts(); a++) {
+      setCatVal(inst, a, cache_.getCatVal(a));
+    }
+
+    setClass(inst, cache_.getClass());
+
+    for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+      setNumVal(inst, a, cache_.getNumVal(a));
+    }
+
+    setDense(inst);
+
+    line++;
+
+    return true;
+  }
+
+  if (!(pool_ != NULL ? readParsed(&inst) : readInstance(inst))) {
+    // the first pass is complete so the cache can be used for the following passes
+    if (cache_.isWriting()) cache_.commit(metadata_.precision);
+
+    return false;
+  }
+
+  if (cache_.isWriting()) cache_.write(inst);
+
+  return true;
+}
+
+/// advance to the next instance, mapping each numeric value straight to its discretised value.  When the file is parsed
+/// on this thread the values are discretised as they are parsed, without being stored in an intermediate instance.
+bool InstanceFile::advanceDiscretised(instance &inst, const Cuts &cuts) {
+  const CategoricalAttribute firstNum = getNoCatAtts();
+
+  setDense(inst);
+
+  if (cache_.isReading()) {
+    if (!cache_.next()) return false;
+
+    for (CategoricalAttribute a = 0; a < firstNum; a++) {
+      setCatVal(inst, a, cache_.getCatVal(a));
+    }
+
+    setClass(inst, cache_.getClass());
+
+    for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+      setCatVal(inst, firstNum + a, discretiseValue(cache_.getNumVal(a), cuts[a]));
+    }
+
+    line++;
+
+    return true;
+  }
+
+  if (cache_.isWriting() || pool_ != NULL) {
+    // the instance must be parsed in full to be written to the cache, and has already been parsed if it was parsed in parallel
+    const instance *parsed;
+
+    if (cache_.isWriting()) {
+      if (!advance(cacheInst_)) return false;
+      parsed = &cacheInst_;
+    }
+    else {
+      parsed = nextParsed();
+      if (parsed == NULL) return false;
+    }
+
+    for (CategoricalAttribute a = 0; a < firstNum; a++) {
+      setCatVal(inst, a, parsed->getCatVal(a));
+    }
+
+    setClass(inst, parsed->getClass());
+
+    for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+      setCatVal(inst, firstNum + a, discretiseValue(parsed->getNumVal(a), cuts[a]));
+    }
+
+    return true;
+  }
+
+  return readInstance(inst, &cuts);
+}
+
+bool InstanceFile::readInstance(instance &inst, const Cuts *cuts) {
+  while (more() && isspace(static_cast<unsigned char>(*pos_))) {
+    if (*pos_ == '\n') line++;
+    pos_++;
+  }
+
+  bufferRecord();
+
+  // the whole of the line is now in [pos_, end_)
+  try {
+    return parseInstance(pos_, end_, line, metadata_.precision, inst, cuts);
+  }
+  catch (ParseError &e) {
+    error("%s", e.msg);
+  }
+
+  return false;
+}
+
+/// read only the flagged attributes.  Every value is still parsed while a cache is written, as the cache must hold them all.
+void InstanceFile::setProjection(const std::vector<bool> &catAtts, const std::vector<bool> &numAtts) {
+  skip_.assign(metadata_.noOfAttributes(), false);
+
+  bool skipping = false;
+
+  for (ioMetadata::Attribute att = 0; att < metadata_.noOfAttributes(); att++) {
+    switch (metadata_.attTypes[att]) {
+      case CATEGORICAL:
+        skip_[att] = !catAtts.empty() && !catAtts[metadata_.internalAtt[att]];
+        break;
+      case NUMERIC:
+        skip_[att] = !numAtts.empty() && !numAtts[metadata_.internalAtt[att]];
+        break;
+      case CLASS:
+        break;
+    }
+
+    if (skip_[att]) skipping = true;
+  }
+
+  if (!skipping) skip_.clear();
+}
+
+// a delimited value ends where readName or readNum stops
+void InstanceFile::skipValue(const char *&p, const char *end, const unsigned int att) const {
+  const unsigned int width = metadata_.colWidth[att];
+
+  if (width != 0) {
+    p += static_cast<size_t>(end - p) > width ? width : end - p;
+  }
+  else {
+    while (p < end && static_cast<unsigned char>(*p) >= ' ' && *p != ',') p++;
+  }
+}
+
+// parse the next instance from [p, end), which must hold whole lines.  If cuts is not NULL the numeric values are discretised
+bool InstanceFile::parseInstance(const char *&p, const char *end, LineCount &lineNo, std::vector<unsigned int> &attPrecision, instance &inst, const Cuts *cuts) {
+  while (p < end && isspace(static_cast<unsigned char>(*p))) {
+    if (*p == '\n') lineNo++;
+    p++;
+  }
+
+  // a cache must hold every value
+  const bool projected = !skip_.empty() && !cache_.isWriting();
+
+  if (metadata_.inputFormat_ == ioMetadata::gigal_FORMAT) {
+    ioMetadata::Attribute att = 0;
+
+    setDense(inst);
+
+    while (p < end && *p != '\n' && *p != '\r') {
+      if (att == metadata_.noOfAttributes()) {
+        throw ParseError("More values than attributes on line %" LCFMT, lineNo);
+      }
+
+      if (projected && skip_[att]) skipValue(p, end, att);
+      else switch (metadata_.attTypes[att]) {
+        case CATEGORICAL:
+          setCatVal(inst, metadata_.internalAtt[att], metadata_.readCatVal(p, end, att, lineNo));
+          break;
+        case CLASS:
+          setClass(inst, metadata_.readClass(p, end, lineNo));
+          break;
+        case NUMERIC:
+          if (cuts == NULL) {
+            setNumVal(inst, metadata_.internalAtt[att], metadata_.readNum(p, end, metadata_.internalAtt[att], attPrecision));
+          }
+          else {
+            const NumericAttribute na = metadata_.internalAtt[att];
+            setCatVal(inst, getNoCatAtts() + na, discretiseValue(metadata_.readNum(p, end, na, attPrecision), (*cuts)[na]));
+          }
+          break;
+      }
+
+      if (p < end && *p == ',') p++;
+
+      while (p < end && *p != '\n' && *p != '\r' && isspace(static_cast<unsigned char>(*p))) p++;
+
+      att++;
+    }
+
+    if (p < end) p++;  // consume the line terminator
+
+    if (att < metadata_.noOfAttributes()) {
+      if (att) {
+        throw ParseError("Fewer values than attributes on line %" LCFMT, lineNo);
+      }
+
+      return false;
+    }
+  }
+  else {
+    // libSVM format input
+    if (p == end) {
+      return false;
+    }
+
+    setClass(inst, metadata_.readClass(p, end, lineNo, ' '));
+
+    while (p < end && *p == ' ') p++;
+
+    // only the attributes present in the row are set, so the work is proportional to the number of non-zero values
+    startSparse(inst);
+
+    ioMetadata::Attribute att;
+
+    while (p < end && *p != '\n') {
+      att = 0;
+
+      if (*p < '0' || *p > '9') throw ParseError("libSVM format error: encountered '%c' when expecting an Attribute index", *p);
+      
+      // get the Attribute index
+      while (p < end && *p >= '0' && *p <= '9') {
+        att *= 10;
+        att += *p - '0';
+        p++;
+      }
+
+      if (att == 0 || att > metadata_.noOfAttributes()) {
+        throw ParseError("Attribute index %d out of range on line %" LCFMT, att, lineNo);
+      }
+
+      att--;    // indexes start from 1, internal indexes start fro m0
+
+      if (p == end || *p != ':') {
+        throw ParseError("Missing : following Attribute index %d on line %" LCFMT, att, lineNo);
+      }
+      
+      p++;
+
+      if (projected && skip_[att]) {
+        // the attribute is left at 0
+        while (p < end && *p != ' ' && *p != '\n') p++;
+      }
+      else {
+        setSparseNumVal(inst, att, metadata_.readNum(p, end, att, attPrecision));
+      }
+
+      while (p < end && *p == ' ') p++;
+    }
+
+    if (p < end) p++;  // consume the line terminator
+  }
+
+  lineNo++;
+
+  return true;
+}
+
+// parse every instance in a chunk.  An error stops the parse and is reported when the chunk is read.
+void InstanceFile::parseChunk(ParseChunk &chunk) {
+  const char *p = chunk.begin;
+
+  chunk.count = 0;
+  chunk.lines = 0;
+  chunk.failed = false;
+  chunk.precision.assign(getNoNumAtts(), 0);
+
+  try {
+    while (true) {
+      if (chunk.count == chunk.insts.size()) {
+        // the instances of a sparse file are held as pairs alone, as their full width may be very large
+        chunk.insts.push_back(metadata_.inputFormat_ == ioMetadata::LIBSVM_FORMAT ? instance() : instance(*this));
+      }
+
+      if (!parseInstance(p, chunk.end, chunk.lines, chunk.precision, chunk.insts[chunk.count])) break;
+
+      chunk.count++;
+    }
+  }
+  catch (ParseError &) {
+    chunk.failed = true;
+  }
+}
+
+// split the next window of the data file into one chunk per thread at line boundaries and parse them in parallel
+bool InstanceFile::parseWindow() {
+  const size_t windowSize = chunkSize_ * chunks_.size();
+
+  if (chunkSize_ < PARSE_CHUNK_SIZE) chunkSize_ *= 2;
+  const char *windowEnd;
+
+  if (mapped_) {
+    if (pos_ == end_) return false;
+
+    if (static_cast<size_t>(end_ - pos_) <= windowSize) {
+      windowEnd = end_;
+    }
+    else {
+      const char *nl = static_cast<const char*>(memchr(pos_ + windowSize - 1, '\n', end_ - (pos_ + windowSize - 1)));
+      windowEnd = nl == NULL ? end_ : nl + 1;
+    }
+  }
+  else {
+    while (!atEOF_ && static_cast<size_t>(end_ - pos_) < windowSize) fill();
+
+    while (true) {
+      const char *limit = static_cast<size_t>(end_ - pos_) > windowSize ? pos_ + windowSize : end_;
+
+      if (atEOF_ && limit == end_) {
+        windowEnd = end_;
+        break;
+      }
+
+      // end the window at the last line terminator before the limit
+      const char *p = limit;
+
+      while (p > pos_ && p[-1] != '\n') p--;
+
+      if (p > pos_) {
+        windowEnd = p;
+        break;
+      }
+
+      // the first line is longer than the window
+      const char *nl = static_cast<const char*>(memchr(limit, '\n', end_ - limit));
+
+      if (nl != NULL) {
+        windowEnd = nl + 1;
+        break;
+      }
+
+      if (atEOF_) {
+        windowEnd = end_;
+        break;
+      }
+
+      fill();
+    }
+
+    if (pos_ == end_) return false;
+  }
+
+  const size_t len = windowEnd - pos_;
+  const char *begin = pos_;
+
+  for (unsigned int i = 0; i < chunks_.size(); i++) {
+    const char *e = windowEnd;
+
+    if (i + 1 < chunks_.size()) {
+      e = pos_ + len * (i + 1) / chunks_.size();
+
+      if (e <= begin) {
+        e = begin;
+      }
+      else {
+        const char *nl = static_cast<const char*>(memchr(e - 1, '\n', windowEnd - (e - 1)));
+        e = nl == NULL ? windowEnd : nl + 1;
+      }
+    }
+
+    chunks_[i].begin = begin;
+    chunks_[i].end = e;
+    begin = e;
+  }
+
+  ChunkParser parser(*this);
+  pool_->run(parser);
+
+  pos_ = windowEnd;
+
+  // report the first error in the window.  The chunk is parsed again from its first line so that the error is reported with the right line number.
+  LineCount chunkLine = line;
+
+  for (unsigned int i = 0; i < chunks_.size(); i++) {
+    if (chunks_[i].failed) {
+      const char *p = chunks_[i].begin;
+      instance inst(*this);
+      std::vector<unsigned int> precision(getNoNumAtts(), 0);
+
+      try {
+        while (parseInstance(p, chunks_[i].end, chunkLine, precision, inst)) {}
+      }
+      catch (ParseError &e) {
+        error("%s", e.msg);
+      }
+    }
+
+    chunkLine += chunks_[i].lines;
+
+    for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+      if (chunks_[i].precision[a] > metadata_.precision[a]) metadata_.precision[a] = chunks_[i].precision[a];
+    }
+  }
+
+  chunk_ = 0;
+  next_ = 0;
+
+  return true;
+}
+
+bool InstanceFile::readParsed(instance *inst) {
+  const instance *parsed = nextParsed();
+
+  if (parsed == NULL) return false;
+
+  if (inst != NULL) {
+    if (parsed->isSparse()) {
+      setClass(*inst, parsed->getClass());
+      startSparse(*inst);
+      for (unsigned int i = 0; i < parsed->getNoNonZero(); i++) {
+        setSparseNumVal(*inst, parsed->getNonZeroAtt(i), parsed->getNonZeroVal(i));
+      }
+    }
+    else {
+      *inst = *parsed;
+    }
+  }
+
+  return true;
+}
+
+const instance *InstanceFile::nextParsed() {
+  while (true) {
+    if (chunk_ < chunks_.size()) {
+      ParseChunk &chunk = chunks_[chunk_];
+
+      if (next_ < chunk.count) {
+        return &chunk.insts[next_++];
+      }
+
+      line += chunk.lines;
+      chunk_++;
+      next_ = 0;
+    }
+    else if (!parseWindow()) {
+      return NULL;
+    }
+  }
+}
+
+bool InstanceFile::canAdvanceDiscretised() {
+  return metadata_.inputFormat_ == ioMetadata::gigal_FORMAT;
+}
+
+bool InstanceFile::parsedRemaining() const {
+  if (chunk_ < chunks_.size() && next_ < chunks_[chunk_].count) return true;
+
+  for (unsigned int i = chunk_ + 1; i < chunks_.size(); i++) {
+    if (chunks_[i].count != 0) return true;
+  }
+
+  return false;
+}
+
+// check whether there is any more input in the file
+bool InstanceFile::isAtEnd() {
+  if (cache_.isReading()) return cache_.isAtEnd();
+
+  if (pool_ != NULL && parsedRemaining()) return false;
+
+  while (more() && isspace(static_cast<unsigned char>(*pos_))) pos_++;
+
+  if (pos_ != end_) return false;
+
+  // the first pass is complete so the cache can be used for the following passes
+  if (cache_.isWriting()) cache_.commit(metadata_.precision);
+
+  return true;
+}
+
+/// the number of instances in the file.
+/// the count is taken from the index (a file with the file's filename + ".idx"), which is built by scanning the file if it does not exist or is out of date.
+/// if there is no up to date index but a count file exists (a file whith the file's filename + ".cnt") and is more recet than the file, read the count from the count file instead.
+InstanceCount InstanceFile::size() {
+  if (streaming_ && cache_.isWriting()) spillRest();
+
+  if (cache_.isReading()) return cache_.size();
+
+  if (index_.isValid() || loadIndex()) return index_.size();
+
+  char *cntfname;
+  safeAlloc(cntfname, strlen(metadata_.filename) + 5);
+
+  sprintf(cntfname, "%s%s", metadata_.filename, ".cnt");
+
+  struct stat buf;
+
+  int result;
+   
+  // Get data associated with cnt file: 
+  result = stat( cntfname, &buf );
+
+  // Check if the cnt file exists 
+  if( result == 0 ) {
+      struct stat buf2;
+
+    // Get data associated with fname: 
+    result = stat( metadata_.filename, &buf2 );
+
+    // Check if the file exists 
+    if( result == 0 ) {
+      // check whether the cnt file is more recent
+      if (buf.st_mtime > buf2.st_mtime) {
+        InstanceCount cnt = 0;
+
+        FILE *f = fopen(cntfname, "r");
+
+        if (f != NULL) {
+          (void)fscanf(f, "%" ICFMT, &cnt);
+          fclose(f);
+          delete []cntfname;
+          return cnt;
+        }
+      }
+    }
+  }
+
+  delete []cntfname;
+
+  buildIndex();
+
+  return index_.size();
+}
+
+bool InstanceFile::loadIndex() {
+  std::vector<char> indexName(strlen(metadata_.filename) + 5);
+  sprintf(&indexName[0], "%s.idx", metadata_.filename);
+
+  return index_.load(&indexName[0], metadata_.filename);
+}
+
+void InstanceFile::buildIndex() {
+  std::vector<char> indexName(strlen(metadata_.filename) + 5);
+  sprintf(&indexName[0], "%s.idx", metadata_.filename);
+
+  index_.build(metadata_.filename);
+
+  if (!index_.save(&indexName[0]) && verbosity >= 2) {
+    printf("Cannot create index %s\n", &indexName[0]);
+  }
+}
+
+/// position the stream so that the next advance returns instance inst, using the index to skip directly to the nearest indexed instance
+bool InstanceFile::seek(const InstanceCount inst) {
+  if (streaming_ && cache_.isWriting()) spillRest();
+
+  if (cache_.isReading()) return cache_.seek(inst);
+
+  rewind();
+
+  if (inst == 0) return true;
+
+  // the cache can only be written by a pass that starts from the first instance
+  if (cache_.isWriting()) cache_.close();
+
+  if (!index_.isValid() && !loadIndex()) buildIndex();
+
+  if (inst >= index_.size()) {
+    // position the stream at the end of the file
+    pos_ = end_;
+    atEOF_ = true;
+
+    return inst == index_.size();
+  }
+
+  unsigned long long offset;
+  unsigned long long lineNo;
+  InstanceCount skip;
+
+  index_.find(inst, offset, lineNo, skip);
+
+  if (mapped_) {
+    pos_ = map_ + offset;
+  }
+  else {
+    source_.seek(offset);
+  }
+
+  line = static_cast<LineCount>(lineNo);
+
+  while (skip-- > 0) skipLine();
+
+  return true;
+}
+
+unsigned long long InstanceFile::offsetOf(const char *p) {
+  if (mapped_) return p - map_;
+
+  return source_.getPosition() - (end_ - p);
+}
+
+void InstanceFile::moveTo(const unsigned long long offset) {
+  if (mapped_) {
+    pos_ = map_ + offset;
+    return;
+  }
+
+  const unsigned long long start = offsetOf(&buffer_[0]);
+
+  if (offset >= start && offset <= offsetOf(end_)) {
+    pos_ = &buffer_[0] + (offset - start);
+  }
+  else {
+    source_.seek(offset);
+    pos_ = end_ = &buffer_[0];
+    atEOF_ = false;
+  }
+}
+
+/// a sample of about n instances taken without reading the whole file, when approximate: for each of n random byte offsets
+/// the first line that starts at or after the offset is parsed.  Long lines are more likely to be sampled, so the sample is
+/// close to, but not exactly, uniform.  Return false, so that the caller takes its sample by a pass, if the file cannot be
+/// read from an offset (it is compressed, a pipe or read from the cache), if it appears to hold no more than n instances or
+/// if a sampled line cannot be parsed (so that the error is reported by the pass).  The exact sample is taken by sampleBySeek.
+bool InstanceFile::sample(const InstanceCount n, const bool approximate, std::vector<instance> &insts) {
+  if (n == 0 || streaming_) return false;
+
+  if (!approximate) return sampleBySeek(n, insts);
+
+  if (cache_.isReading() || (!mapped_ && source_.isCompressed())) return false;
+
+  unsigned long long fileSize;
+
+  if (mapped_) {
+    fileSize = mapSize_;
+  }
+  else {
+    struct stat buf;
+
+    if (stat(metadata_.filename, &buf) != 0) return false;
+
+    fileSize = buf.st_size;
+  }
+
+  rewind();
+
+  // the number of lines, from the index if there is one, otherwise estimated from the start of the file
+  unsigned long long lines;
+
+  if (index_.isValid() || loadIndex()) {
+    lines = index_.size();
+  }
+  else {
+    if (!mapped_) fill();
+
+    const size_t head = std::min<size_t>(end_ - pos_, INPUT_BUFFER_SIZE);
+
+    lines = head == 0 ? 0 : std::count(pos_, pos_ + head, '\n') * (fileSize / static_cast<double>(head));
+  }
+
+  if (lines <= n) {
+    rewind();
+    return false;
+  }
+
+  MTRand_int32 rand;
+  std::vector<unsigned long long> offsets(n);
+
+  for (InstanceCount i = 0; i < n; i++) {
+    offsets[i] = ((static_cast<unsigned long long>(rand()) << 32) | rand()) % fileSize;
+  }
+
+  std::sort(offsets.begin(), offsets.end());
+
+  insts.resize(n);
+
+  InstanceCount count = 0;
+  unsigned long long lineStart = 0;  // the offset of the last line parsed
+  LineCount lineNo = 0;
+
+  try {
+    for (InstanceCount i = 0; i < n; i++) {
+      if (count > 0 && offsets[i] <= lineStart) {
+        // the first line starting at or after the offset is the last line parsed
+        insts[count] = insts[count - 1];
+        count++;
+        continue;
+      }
+
+      // resynchronise to the start of the next line
+      if (offsets[i] == 0) {
+        moveTo(0);
+      }
+      else {
+        moveTo(offsets[i] - 1);
+        while (more() && *pos_++ != '\n') {}
+      }
+
+      while (more() && isspace(static_cast<unsigned char>(*pos_))) pos_++;
+
+      // the offset is within the last line, as are all those that follow
+      if (pos_ == end_) break;
+
+      lineStart = offsetOf(pos_);
+
+      bufferRecord();
+
+      insts[count].init(*this);
+
+      if (!parseInstance(pos_, end_, lineNo, metadata_.precision, insts[count])) break;
+
+      count++;
+    }
+  }
+  catch (ParseError &) {
+    rewind();
+    return false;
+  }
+
+  insts.resize(count);
+
+  rewind();
+
+  return count > 0;
+}
+
+/// The reservoir that a pass would fill is drawn from the number of instances alone, so the instance a pass would leave in
+/// each slot is known before any is read.  These are then read in order, seeking over the gaps that span an indexed position
+/// (or a cache block) and skipping the lines of shorter gaps without parsing them.  The number of instances is taken from the
+/// index, which is built, as for seek, by scanning the file without parsing it if it is missing.  Return false, so that the
+/// caller takes its sample by a pass, if the file is compressed and so cannot be read from an offset, if a cache is to be
+/// written, as that takes a pass from the first instance, or if the file holds no more than n instances.
+bool InstanceFile::sampleBySeek(const InstanceCount n, std::vector<instance> &insts) {
+  InstanceCount count;
+  InstanceCount stride;   // the gap beyond which a seek is quicker than skipping
+
+  if (cache_.isReading()) {
+    count = cache_.size();
+    stride = InstanceCache::BLOCK_SIZE;
+  }
+  else if (caching_ || (!mapped_ && source_.isCompressed())) {
+    return false;
+  }
+  else {
+    if (!index_.isValid() && !loadIndex()) buildIndex();
+
+    count = index_.size();
+    stride = InstanceIndex::INTERVAL;
+  }
+
+  if (count <= n) return false;
+
+  // the instance a pass would leave in each slot of the reservoir, drawn as InstanceStreamDiscretiser draws them
+  MTRand_int32 rand;
+  std::vector<std::pair<InstanceCount, InstanceCount> > chosen(n);  // each instance chosen and its slot
+
+  for (InstanceCount i = 0; i < count; i++) {
+    const InstanceCount slot = i < n ? i : rand(i + 1);
+
+    if (slot < n) chosen[slot] = std::make_pair(i, slot);
+  }
+
+  std::sort(chosen.begin(), chosen.end());
+
+  insts.resize(n);
+
+  rewind();
+
+  InstanceCount next = 0;  // the instance the next advance returns
+
+  for (InstanceCount i = 0; i < n; i++) {
+    const InstanceCount inst = chosen[i].first;
+
+    if (inst - next >= stride) {
+      if (!seek(inst)) return false;
+    }
+    else {
+      for (; next < inst; next++) {
+        if (!advance()) return false;
+      }
+    }
+
+    instance &sampled = insts[chosen[i].second];
+
+    sampled.init(*this);
+
+    if (!advance(sampled)) return false;
+
+    next = inst + 1;
+  }
+
+  rewind();
+
+  return true;
+}
+
+InstanceFile::ioMetadata::~ioMetadata(void)
+{
+  for (Attribute a = 0; a < noOfAttributes(); a++) {
+    delete []attNames[a];
+  }
+
+  for (CategoricalAttribute a = 0; a < attValNames.size(); a++) {
+    for (CatValue v = 0; v < attValNames[a].size(); v++) {
+      delete []attValNames[a][v];
+    }
+  }
+
+  for (CatValue v = 0; v < classNames_.size(); v++) {
+    delete []classNames_[v];
+  }
+}
+
+const char* InstanceFile::ioMetadata::getName() {
+  return filename;
+}
+
+///< true iff name comparisons are case sensitive
+bool InstanceFile::ioMetadata::areNamesCaseSensitive() {
+  return caseSensitive;
+}
+
+/// return the name for a class
+const char* InstanceFile::ioMetadata::getClassName(CatValue att) const {
+  return classNames_[att];
+}
+
+/// return the name for the class attribute
+const char* InstanceFile::ioMetadata::getClassAttName() const {
+  return attNames[class2io];
+}
+
+unsigned int InstanceFile::ioMetadata::getNoClasses() const {
+  return classNames_.size();
+}
+
+unsigned int InstanceFile::ioMetadata::getNoCatAtts() const {
+  return attValNames.size();
+}
+
+unsigned int InstanceFile::ioMetadata::getNoValues(CategoricalAttribute att) const {
+  assert(att < attValNames.size());
+  return attValNames[att].size();
+}
+
+const char* InstanceFile::ioMetadata::getCatAttName(CategoricalAttribute att) const {
+  return attNames[cat2io[att]];
+}
+
+const char* InstanceFile::ioMetadata::getCatAttValName(CategoricalAttribute att, CatValue val) const {
+  return attValNames[att][val];
+}
+
+unsigned int InstanceFile::ioMetadata::getNoNumAtts() const {
+  return num2io.size();
+}
+
+const char* InstanceFile::ioMetadata::getNumAttName(NumericAttribute att) const {
+  return attNames[num2io[att]];
+}
+
+/// return the precision to which values of a numeric attribute should be output
+unsigned int InstanceFile::ioMetadata::getPrecision(NumericAttribute att) const {
+  return precision[att];
+}
+
+/// return whether a categorical attribute contains missing values
+int InstanceFile::ioMetadata::hasCatMissing(CategoricalAttribute att) const {
+  return missingVals[cat2io[att]];
+}
+
+/// return whether a numeric attribute contains missing values
+int InstanceFile::ioMetadata::hasNumMissing(NumericAttribute att) const {
+  return missingVals[num2io[att]];
+}
+
+InstanceFile::ioMetadata::ioMetadata(const bool case_sensitive) : caseSensitive(case_sensitive)
+{
+}
+
+void InstanceFile::ioMetadata::setAllAttsMissing(){
+  missingVals.assign(missingVals.size(),1);
+}
+
+// reads a string terminated by EOF, \n or the nominated terminator
+// names are truncated at maxNameLength
+void InstanceFile::ioMetadata::readName(FILEtype *f, char *buffer, const char terminator, int &c) const {
+  int i = 0;
+  
+  while (true) {
+    if (c < ' ' || c == EOF || c == terminator) {
+      while (i > 0 && isspace(buffer[i-1])) i--;  // strip trailing spaces
+      buffer[i] = '\0';
+      return;
+    }
+
+    if (c >= ' ' && i < MAX_NAME_LENGTH) {  // truncate names at maxNameLength, discard non printing characters
+      buffer[i++] = static_cast<char>(c);
+    }
+
+    c = getc(f);
+  }
+}
+
+// reads a string from the input buffer terminated by the end of the buffer, a control character or the nominated terminator
+// names are truncated at maxNameLength
+void InstanceFile::ioMetadata::readName(const char *&p, const char *end, char *buffer, const char terminator) const {
+  int i = 0;
+  
+  while (p < end && static_cast<unsigned char>(*p) >= ' ' && *p != terminator) {
+    if (i < MAX_NAME_LENGTH) {  // truncate names at maxNameLength
+      buffer[i++] = *p;
+    }
+
+    p++;
+  }
+
+  while (i > 0 && isspace(static_cast<unsigned char>(buffer[i-1]))) i--;  // strip trailing spaces
+  buffer[i] = '\0';
+}
+
+// reads a fixed width string from the input buffer
+// names are truncated at maxNameLength
+void InstanceFile::ioMetadata::readFWName(const char *&p, const char *end, char *buffer, const unsigned int width) const {
+  unsigned int i = 0;
+  
+  while (p < end && *p != '\n' && *p != '\r' && i < width) {
+    if (i < MAX_NAME_LENGTH) {  // truncate names at maxNameLength
+      buffer[i++] = *p;
+    }
+
+    p++;
+  }
+
+  while (i > 0 && isspace(static_cast<unsigned char>(buffer[i-1]))) i--;  // strip trailing spaces
+  buffer[i] = '\0';
+}
+
+// parse a metadata file
+// The format is
+//   <line> ::= [ : <qualifier> { , <qualifier> } : ] <name> : numeric \n
+//            | [ : <qualifier> { , <qualifier> } : ] <name> : <name> { , <name> } \n
+//            | :: <comment> \n
+//   <qualifier> ::= width=<unsigned int>
+//                 | index=<unsigned int>-<unsigned int>
+//                 | class
+void InstanceFile::ioMetadata::parse(const char *fn) {
+  FILEtype *f;
+  int c;
+  char buffer[MAX_NAME_LENGTH+1];
+  LineCount line = 1;
+  bool classDeclaredBySpecifier = false;
+  bool classDeclared = false;
+  unsigned int noNumAtts = 0;
+  unsigned int noCatAtts = 0;
+  unsigned int noAttributes = 0;      ///< the total number of attributes (including the class)
+
+  f = fopen(fn, "r");
+
+  if (f == NULL) {
+    error("Cannot open metadata file '%s'", fn);
+  }
+
+  if (verbosity >= 1) printf("Loading metadata file %s\n", fn);
+
+  noAttributes  = 0;
+  colWidth.clear();
+  precision.clear();
+  attTypes.clear();
+  attNames.clear();
+  attValNames.clear();
+
+  inputFormat_ = gigal_FORMAT;
+
+  c = getc(f);
+
+  while (c != EOF) {
+    bool classAtt = false;
+    unsigned int width = 0;
+    bool indexed = false;
+    int startIndex = 0;
+    int endIndex = 0;
+
+    while (isspace(c)) {
+      if (c == '\n') line++;
+      c = getc(f);
+    }
+
+    if (c == EOF) break;
+
+    readName(f, buffer, ':', c);
+
+    if (c != ':') {
+      error("Missing colon on line %" LCFMT, line);
+    }
+
+    if (buffer[0] == '\0') {
+      // this means that the first character was ':'
+      // get qualifiers
+
+      c = getc(f);
+
+      readName(f, buffer, ':', c);
+
+      if (buffer[0] == '\0') {
+        // comment
+        while (c != '\n' && c != '\r' && c != EOF) {
+          c = getc(f);
+        }
+        continue;
+      }
+
+      if (streq(buffer, "libsvm")) {
+        // libsvm format
+        if (noAttributes)  error("Cannot combine libsvm declaration with attribute declarations");
+        if (c != ':') error("Expect : after libsvm qualifier");
+
+        c = getc(f);                // advance past the last terminator
+        readName(f, buffer, ':', c); // get the number of attributes
+
+        if (buffer[0] == '\0') error("Missing number of attributes after libsvm qualifier");
+        if (c != '\n' && c != '\r') error("Unexpected elements following number of elements");
+
+        int i = 0;
+
+        while (buffer[i] >= '0' && buffer[i] <= '9') {
+          noNumAtts *= 10;
+          noNumAtts += buffer[i] - '0';
+          i++;
+        }
+
+        // make the required number of copies
+        const int indexLen = printWidth(noNumAtts);
+        int nameLen = indexLen + 2;
+        if (nameLen > MAX_NAME_LENGTH) {
+          nameLen = MAX_NAME_LENGTH;
+        }
+
+        char *buf;
+
+        for (NumericAttribute i = 1; i <= noNumAtts; i++) {
+          safeAlloc(buf, nameLen+1);
+          sprintf(buf, "a_%d", i);
+          attNames.push_back(buf);
+          colWidth.push_back(0);
+          attTypes.push_back(NUMERIC);
+          internalAtt.push_back(noAttributes);
+          num2io.push_back(noAttributes++);
+          precision.push_back(0);
+          missingVals.push_back(0);
+        }
+
+        inputFormat_ = LIBSVM_FORMAT;
+
+        continue;
+      }
+
+      bool finished = false;
+      unsigned int i = 0;
+
+      while (!finished) {
+        // identify the next token
+        const unsigned int start = i;
+
+        while (buffer[i] != '\0' && buffer[i] != ',' && buffer[i] != '=') {
+          i++;
+        }
+
+        const char terminator = buffer[i];
+        buffer[i] = '\0';
+
+        if (streq(buffer+start, "class")) {
+          // this is the class attribute
+          if (terminator == '=') {
+            error("Unexpected = following class specifier on line %" LCFMT, line);
+          }
+          if (classDeclaredBySpecifier) {
+            error("Only one class can be specified. Second class specifier on line %" LCFMT, line);
+          }
+          classAtt = true;
+          classDeclaredBySpecifier = true;
+        }
+        else if (streq(buffer+start, "width")) {
+          // the field is fixed width
+          if (terminator != '=') {
+            error("Expected = following width specifier on line %" LCFMT, line);
+          }
+
+          i++;  // skip '='
+
+          while (buffer[i] >= '0' && buffer[i] <= '9') {
+            width *= 10;
+            width += buffer[i++] - '0';
+          }
+        }
+        else if (streq(buffer+start, "index")) {
+          // there are endIndex-startIndex+1 repetitions of an identical attribute
+          // they all share a common name indexed by the specified range of indices
+          if (terminator != '=') {
+            error("Expected = following index specifier on line %" LCFMT, line);
+          }
+
+          indexed = true;
+          i++;  // skip '='
+
+          while (buffer[i] >= '0' && buffer[i] <= '9') {
+            startIndex *= 10;
+            startIndex += buffer[i++] - '0';
+          }
+
+          if (buffer[i] != '-') {
+            error("Expected - following first index on line %" LCFMT, line);
+          }
+
+          i++;  // skip '-'
+
+          while (buffer[i] >= '0' && buffer[i] <= '9') {
+            endIndex *= 10;
+            endIndex += buffer[i++] - '0';
+          }
+        }
+        else {
+            error("Error in meta information on line %" LCFMT, line);
+        }
+
+        if (buffer[i] == '\0') {
+          finished = true;
+        }
+        else if (buffer[i] == ',') {
+          i++;
+        }
+        else {
+            error("Error in meta information on line %" LCFMT, line);
+        }
+      }
+
+      c = getc(f);                // advance past the last terminator
+      readName(f, buffer, ':', c); // get the attribute name
+    }
+
+
+    char *buf;
+
+    if (indexed) {
+      // make the required number of copies
+      int nameLen = strlen(buffer);
+      const int indexLen = printWidth(endIndex);
+      if (nameLen + indexLen >= MAX_NAME_LENGTH) {
+        nameLen = MAX_NAME_LENGTH - indexLen;
+      }
+
+      for (int i = startIndex; i <= endIndex; i++) {
+        safeAlloc(buf, strlen(buffer)+indexLen+2);
+        strcpy(buf, buffer);
+        sprintf(buf+nameLen, "_%d", i);
+        attNames.push_back(buf);
+        colWidth.push_back(width);
+      }
+    }
+    else {
+      safeAlloc(buf, strlen(buffer)+1);
+      strcpy(buf, buffer);
+      attNames.push_back(buf);
+      colWidth.push_back(width);
+    }
+
+    if (streq(buf, "class") && !classDeclaredBySpecifier) {
+      classAtt = true;
+    }
+
+    c = getc(f);
+
+    while (isspace(c)) {
+      c = getc(f);
+    }
+
+    if (c == EOF || c == '\n' || c == '\r') {
+      error("Missing attribute type on line %" LCFMT, line);
+    }
+
+    // get the first value or the type
+    readName(f, buffer, ',', c);
+
+    if (streq(buffer, "numeric")) {
+      //c = getc(f); 
+      int missing = 0;
+      if(c == ','){
+        c = getc(f);
+        assert (c == '?');
+        missing = 1;
+        c = getc(f);
+      }
+      for (int i = startIndex; i <= endIndex; i++) {
+        attTypes.push_back(NUMERIC);
+        internalAtt.push_back(noNumAtts++);
+        num2io.push_back(noAttributes++);
+        precision.push_back(0);
+        missingVals.push_back(missing);
+      }
+    }
+    else {
+      // must be a list of the allowed values for the attribute
+      std::vector<char *> valNames;
+
+      char *buf;
+      safeAlloc(buf, strlen(buffer)+1);
+      strcpy(buf, buffer);
+      valNames.push_back(buf);
+      
+      int missing = 0;
+      
+      if (streq(buffer,"?"))
+        missing = 1;
+
+      while (c != '\n' && c != '\r' && c != EOF) {
+        if (isspace(c)) {
+          c = getc(f);
+        }
+        else {
+          if (c != ',') {
+            error("Syntax eror on line %" LCFMT, line);
+          }
+          
+          c = getc(f);
+          while (isspace(c)) c = getc(f);
+          
+          readName(f, buffer, ',', c);
+          
+          for (std::vector<char *>::const_iterator it = valNames.begin(); it != valNames.end(); it++) {
+            if (streq(buffer, *it, caseSensitive)) {
+              error("Value '%s' declared twice for attribute '%s'", buffer, attNames.back());
+            }
+          }
+
+          safeAlloc(buf, strlen(buffer)+1);
+          strcpy(buf, buffer);
+          valNames.push_back(buf);
+          
+          if (streq(buffer,"?"))
+            missing = 1;
+        }
+      }
+
+      for (int i = startIndex; i <= endIndex; i++) {
+        if (classAtt) {
+          if (indexed) {
+            error("Class cannot be indexed");
+          }
+          attTypes.push_back(CLASS);
+          internalAtt.push_back(0);
+          classDeclared = true;
+          classNames_ = valNames;
+          class2io = noAttributes++;
+          missingVals.push_back(missing);
+        }
+        else {
+          attTypes.push_back(CATEGORICAL);
+          internalAtt.push_back(noCatAtts++);
+          cat2io.push_back(noAttributes++);
+
+          // need to duplicate the value names
+          if (i > startIndex) {
+            for (CatValue v = 0; v < valNames.size(); v++) {
+              char *buf;
+              safeAlloc(buf, strlen(valNames[v])+1);
+              strcpy(buf, valNames[v]);
+              valNames[v] = buf;
+            }
+          }
+          attValNames.push_back(valNames);
+          missingVals.push_back(missing);
+        }
+      }
+    }
+
+    if (c == '\n') {
+      line++;
+      c = getc(f);
+    }
+    else {
+      if (c != EOF) {
+        error("Syntax error on line %" LCFMT, line);
+      }
+    }
+  }
+
+  if (!classDeclared) {
+    error("No class declared in metadata file '%s'", fn);
+  }
+
+  fclose(f);
+
+  attValTables.resize(noCatAtts);
+  for (unsigned int a = 0; a < noCatAtts; a++) {
+    attValTables[a].init(attValNames[a], caseSensitive);
+  }
+  classTable_.init(classNames_, caseSensitive);
+
+  assert(noAttributes == noNumAtts + noCatAtts + 1);
+  assert(attTypes.size() == noAttributes);
+  assert(colWidth.size() == noAttributes);
+  assert(attNames.size() == noAttributes);
+  assert(precision.size() == noNumAtts);
+  assert(attValNames.size() == noCatAtts);
+  assert(internalAtt.size() == noAttributes);
+  assert(cat2io.size() == noCatAtts);
+  assert(num2io.size() == noNumAtts);
+  assert(missingVals.size() == noAttributes);
+}
+
+const CatValue InstanceFile::ioMetadata::ValueTable::NOVALUE;
+
+void InstanceFile::ioMetadata::ValueTable::init(const std::vector<char *> &names, const bool caseSensitive) {
+  names_ = &names;
+  caseSensitive_ = caseSensitive;
+
+  // keep the table at most half full so that probe sequences are short
+  unsigned int size = 2;
+  while (size < 2 * names.size()) size *= 2;
+  mask_ = size - 1;
+  slots_.assign(size, NOVALUE);
+
+  for (CatValue v = 0; v < names.size(); v++) {
+    unsigned int s = hash(names[v], caseSensitive) & mask_;
+    while (slots_[s] != NOVALUE) s = (s + 1) & mask_;
+    slots_[s] = v;
+  }
+}
+
+CatValue InstanceFile::ioMetadata::getVal(const char *valname, const std::vector<char *> &valNames, const char *attname) const {
+  unsigned int i = 0;
+
+  while (i < valNames.size()) {
+    if (streq(valname, valNames[i], caseSensitive)) {
+      return i;
+    }
+
+    i++;
+  }
+
+  error("'%s' is not a value for attribute '%s'", valname, attname);
+}
+
+CatValue InstanceFile::ioMetadata::readVal(const char *&p, const char *end, const unsigned int colWidth, const ValueTable &values, const char * attName, LineCount line, const char delimiter) const {
+  assert(noOfAttributes()>0); // check that the metadata has been parsed before it is used
+
+  char buffer[MAX_NAME_LENGTH+1];
+
+  if (colWidth) {
+    readFWName(p, end, buffer, colWidth);
+  }
+  else {
+    readName(p, end, buffer, delimiter);
+  }
+
+  const CatValue v = values.find(buffer);
+
+  if (v != ValueTable::NOVALUE) {
+    return v;
+  }
+
+  throw ParseError("'%s' is not a value for attribute '%s' on line %" LCFMT, buffer, attName, line);
+}
+
+CatValue InstanceFile::ioMetadata::readClass(const char *&p, const char *end, const LineCount line, const char delimiter) const {
+  return readVal(p, end, colWidth[class2io], classTable_, attNames[class2io], line, delimiter);
+}
+
+// true iff a double lies exactly halfway between two adjacent normal floats, in which case converting it to a float may not round the value from which it was computed correctly
+static inline bool isFloatHalfway(const double v) {
+  unsigned long long bits;
+  memcpy(&bits, &v, sizeof(bits));
+  return (bits & 0x1FFFFFFFULL) == 0x10000000ULL;  // the 29 bits of a double significand below those of a float are 1000...
+}
+
+// the powers of ten that are exactly representable as doubles
+static const double exactPowerOf10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const unsigned int MAX_EXACT_DIGITS = 19;  ///< the number of significant digits that are accumulated exactly in an unsigned long long
+
+// get a number for the specified attribute
+// The significant digits are accumulated in an integer that is then scaled by an exactly representable power of ten,
+// giving a correctly rounded double from which the float is rounded.  Numbers with too many digits or too large an
+// exponent for this, and the rare results that lie halfway between two floats, are converted by strtof.
+// The precision of the attribute is the number of decimal places specified less the exponent.
+NumValue InstanceFile::ioMetadata::readNum(const char *&p, const char *end, const NumericAttribute att, std::vector<unsigned int> &attPrecision) const {
+  assert(noOfAttributes()>0); // check that the metadata has been parsed before it is used
+
+  if (p < end && *p == '?') {
+    // missing value
+    p++;                // advance past character
+    return MISSINGNUM;  // return the missing value
+  }
+
+  // a fixed width column ends after its width
+  const unsigned int width = colWidth[num2io[att]];
+  const char *limit = (width != 0 && static_cast<size_t>(end - p) > width) ? p + width : end;
+  const char *start = p;
+
+  bool negative = false;
+
+  if (p < limit && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    p++;
+  }
+
+  unsigned long long mantissa = 0;  // the significant digits
+  unsigned int digits = 0;          // the number of significant digits in the mantissa
+  int scale = 0;                    // the power of ten by which the mantissa is multiplied
+  bool exact = true;                // false if there are more significant digits than the mantissa can hold
+  int thisPrecision = 0;
+
+  while (p < limit && *p >= '0' && *p <= '9') {
+    if (digits == MAX_EXACT_DIGITS) {
+      exact = false;
+    }
+    else {
+      mantissa = 10 * mantissa + (*p - '0');
+      if (mantissa != 0) digits++;
+    }
+    p++;
+  }
+
+  if (p < limit && *p == '.') {
+    p++;
+
+    while (p < limit && *p >= '0' && *p <= '9') {
+      if (digits == MAX_EXACT_DIGITS) {
+        exact = false;
+      }
+      else {
+        mantissa = 10 * mantissa + (*p - '0');
+        if (mantissa != 0) digits++;
+        scale--;
+      }
+      thisPrecision++;
+      p++;
+    }
+  }
+
+  if (p < limit && (*p == 'e' || *p == 'E')) {
+    p++;
+
+    bool negativeExponent = false;
+
+    if (p < limit && (*p == '-' || *p == '+')) {
+      negativeExponent = *p == '-';
+      p++;
+    }
+
+    int exponent = 0;
+
+    while (p < limit && *p >= '0' && *p <= '9') {
+      if (exponent < 100000) exponent = 10 * exponent + (*p - '0');
+      p++;
+    }
+
+    if (negativeExponent) exponent = -exponent;
+
+    scale += exponent;
+    thisPrecision -= exponent;
+  }
+
+  if (thisPrecision < 0) thisPrecision = 0;
+  if (static_cast<unsigned int>(thisPrecision) > attPrecision[att]) attPrecision[att] = thisPrecision;
+
+  if (exact && mantissa <= (1ULL << 53) && scale >= -22 && scale <= 22) {
+    double v = static_cast<double>(mantissa);
+
+    if (scale < 0) v /= exactPowerOf10[-scale];
+    else v *= exactPowerOf10[scale];
+
+    if (v == 0 || (v >= std::numeric_limits<NumValue>::min() && v <= std::numeric_limits<NumValue>::max() && !isFloatHalfway(v))) {
+      return static_cast<NumValue>(negative ? -v : v);
+    }
+  }
+
+  const std::string number(start, p);
+
+  return strtof(number.c_str(), NULL);
+}
+
+#if 0
+bool instance::get(FILEtype *f, LineCount &line) {
+  if (metadata_.inputFormat == ifgigal) {
+    int c = getc(f);
+
+    while (c == ' ') c = getc(f);
+
+    Attribute att = 0;
+
+    while (c != '\n' && c != EOF) {
+      if (att == metadata_.noAttributes) {
+        error("More values than attributes on line %" LCFMT, line);
+      }
+
+      switch (metadata_.attTypes[att]) {
+        case categorical:
+          //catVals[metadata_.internalAtt[att]] = metadata_.getVal(f, metadata_.colWidth[att], metadata_.attValNames[metadata_.internalAtt[att]], metadata_.attNames[att], c, line);
+          catVals[metadata_.internalAtt[att]] = metadata_.getCatVal(f, att, c, line);
+          break;
+        case class_type:
+          //theClass = metadata_.getVal(f, metadata_.colWidth[att], metadata_.classNames, metadata_.attNames[att], c, line);
+          theClass = metadata_.getClass(f, c, line);
+          break;
+        case numeric:
+          numVals[metadata_.internalAtt[att]] = metadata_.getNum(f, metadata_.internalAtt[att], c, line);
+          break;
+      }
+
+      if (c == ',') c = getc(f);
+
+      while (c == ' ') c = getc(f);
+
+      att++;
+    }
+
+    if (att < metadata_.noAttributes) {
+      if (att) {
+        error("Fewer values than attributes on line %" LCFMT, line);
+      }
+      return false;
+    }
+  }
+  else {
+    // libSVM format input
+    int c = getc(f);
+
+    while (c == ' ') c = getc(f);
+
+    if (c == '\n' || c == EOF) return false;
+
+    theClass = metadata_.getClass(f, c, line, ' ');
+
+    while (c == ' ') c = getc(f);
+
+    numVals.assign(metadata_.noNumAtts, 0);
+
+    Attribute att;
+
+    while (c != '\n' && c != EOF) {
+      att = 0;
+
+      // get the Attribute index
+      while (c >= '0' && c <= '9') {
+        att *= 10;
+        att += c - '0';
+        c = getc(f);
+      }
+
+      if (att == 0 || att > metadata_.noAttributes) {
+        error("Attribute index %d out of range on line %" LCFMT, att, line);
+      }
+
+      att--;    // indexes start from 1, internal indexes start fro m0
+
+      if (c != ':') {
+        error("Missing : following Attribute index %d on line %" LCFMT, att, line);
+      }
+      
+      c = getc(f);
+
+      numVals[att] = metadata_.getNum(f, att, c, line);
+
+      while (c == ' ') c = getc(f);
+    }
+  }
+    
+  return true;
+}
+#endif
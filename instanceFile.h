@@ -1,136 +1,257 @@
-/* Open source system for classification learning from very large data
-** Class for an instance stream read sequentially from a file
-** Copyright (C) 2012 Geoffrey I Webb
-**
-** This program is free software: you can redistribute it and/or modify
-** it under the terms of the GNU General Public License as published by
-** the Free Software Foundation, either version 3 of the License, or
-** (at your option) any later version.
-** 
-** This program is distributed in the hope that it will be useful,
-** but WITHOUT ANY WARRANTY; without even the implied warranty of
-** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
-** GNU General Public License for more details.
-** 
-** You should have received a copy of the GNU General Public License
-** along with this program. If not, see <http://www.gnu.org/licenses/>.
-**
-** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
-*/
-#pragma once
-#include "instanceStream.h"
-#include "utils.h"
-#include "FILEtype.h"
-
-class InstanceFile : public InstanceStream
-{
-public:
-  #ifdef SIXTYFOURBITCOUNTS
-    typedef unsigned long long int LineCount; ///< a count of a number of instances
-    #define LCFMT "llu"
-  #else  // SIXTYFOURBITCOUNTS
-    typedef unsigned long int LineCount; ///< a count of a number of instances
-    #define LCFMT "lu"
-  #endif // SIXTYFOURBITCOUNTS
-
-  inline void testLineCount(LineCount &cnt) {
-    if (cnt == std::numeric_limits<LineCount>::max()) {
-      error("Line count exceeds system limit of %" LCFMT, std::numeric_limits<LineCount>::max());
-    }
-  }
-
-  InstanceFile(const char* metaFileName, const char* dataFileName);
-  ~InstanceFile(void);
-
-  void rewind();                                              ///< return to the first instance in the stream
-  bool advance();                                             ///< advance, discarding the next instance in the stream.  Return true iff successful.
-  bool advance(instance &inst);                               ///< advance to the next instance in the stream.  Return true iff successful. @param inst the instance record to receive the new instance. 
-  bool isAtEnd();                                             ///< true if we have advanced past the last instance
-  InstanceCount size();                                       ///< the number of instances in the stream.  This may require a pass through the stream to determine so should be used only if absolutely necessary.
-
-  // InstanceFile specific methods
-  void resetSource(const char* name);                                 ///< change the source file from which the data are read
-
-private:
-  class ioMetadata : public InstanceStream::MetaData {
-  public:
-    ioMetadata(const bool case_sensitive = true);
-    ~ioMetadata(void);
-
-    unsigned int getNoClasses() const;                          ///< return the number of classes
-    const char* getClassName(CatValue y) const;   ///< return the name for a class
-    const char* getClassAttName() const;                        ///< return the name for the class attribute
-    unsigned int getNoCatAtts() const;                          ///< return the number of categorical attributes
-    unsigned int getNoValues(CategoricalAttribute att) const;   ///< return the number of values for a categorical Attribute
-    const char* getCatAttName(CategoricalAttribute att) const;  ///< return the name for a categorical Attribute
-    const char* getCatAttValName(CategoricalAttribute att, CatValue val) const; ///< return the name for a categorical Attribute value
-    unsigned int getNoNumAtts() const;                          ///< return the number of numeric attributes
-    const char* getNumAttName(CategoricalAttribute att) const;  ///< return the name for a numeric Attribute
-    unsigned int getPrecision(NumericAttribute att) const;         ///< return the precision to which values of a numeric attribute should be output
-    int hasCatMissing(CategoricalAttribute att) const;          ///<  return whether a categorical attribute contains missing values
-    int hasNumMissing(NumericAttribute att) const;          ///<  return whether a numeric attribute contains missing values
-    const char* getName();                                      ///< return a string that gives a meaningful name for the stream
-    bool areNamesCaseSensitive();                               ///< true iff name comparisons are case sensitive
-    void setAllAttsMissing();
-
-    static const int MAX_NAME_LENGTH = 200;
-
-    typedef unsigned int Attribute;   
-
-    void parse(const char* fn);         ///< parse a metadata file
-    
-    /// read a categorical value from a file
-    inline CatValue readCatVal(FILEtype *f, const Attribute att, int &c, const LineCount line) const {
-      return readVal(f, colWidth[att], attValNames[internalAtt[att]], attNames[att], c, line);
-    }
-
-    /// read a class from a file
-    virtual CatValue readClass(FILEtype *f, int &c, const LineCount line, const char delimiter = ',') const;
-    
-    /// read a number not in scientific format
-    NumValue readSimpleNum(FILEtype *f, int &c, unsigned int &charsRemaining, unsigned int &precision) const;
-    
-    /// read a number including numbers in scientific format
-    NumValue readNum(FILEtype *f, const NumericAttribute att, int &c);
-
-    inline unsigned int noOfClasses() const { return classNames_.size(); }
-    inline unsigned int noOfAttributes() const { return attNames.size(); }
-
-    std::vector<AttType> attTypes;  ///< the type of each Attribute
-    std::vector<unsigned int> colWidth;   ///< the width of a fixed width column.  0 for variable width delimited fields
-    std::vector<unsigned int> precision;  ///< the precision to which a numeric value is specified
-    std::vector<char *> attNames;         ///< the name of each Attribute
-    std::vector<std::vector<char *> > attValNames;  ///< the names of the values for each categorical Attribute
-    std::vector<int> missingVals;       ///< whether an attribute has o not missing values 
-    std::vector<char *> classNames_;     ///< the names of each class
-    std::vector<Attribute> internalAtt; ///< a map from the io Attribute index to the categorical or numeric Attribute index
-    std::vector<Attribute> cat2io;      ///< a map from categorical Attribute indexes to io indexes
-    std::vector<Attribute> num2io;      ///< a map from numeric Attribute indexes to io indexes
-    Attribute class2io;                 ///< the io index of the class
-    const bool caseSensitive;           /// true iff the input file is case sensitive
-
-    typedef enum {gigal_FORMAT, LIBSVM_FORMAT} InputFormat;
-    InputFormat inputFormat_;        ///< is the file in Gigal or libSVM format
-    char const* filename;  ///< the name of the file
-
-  protected:
-    /// read a categorical value from the input file
-    CatValue readVal(FILEtype *f, const unsigned int colWidth, const std::vector<char *> &valNames, const char* attName, int &c, LineCount line, const char delimiter = ',') const;
-    
-    /// get a categorical value from a string
-    CatValue getVal(const char *valname, const std::vector<char *> &valNames, const char *attname) const;
-
-  private: 
-    /// read the next delimted token from the input file
-    void readName(FILEtype *f, char *buffer, const char terminator, int &c) const;
-    
-    
-    /// read the next fixed width token from the input file
-    void readFWName(FILEtype *f, char *buffer, const unsigned int width, int &c) const;
-  };
-
-  FILE *f;               ///< file pointer for the file
-  ioMetadata metadata_; ///< the metadata for the file
-  LineCount line;        ///< the current input line
-  InstanceCount count_;  ///< a count of the number of instances read so far
-};
+/* Open source system for classification learning from very large data
+** Class for an instance stream read sequentially from a file
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+#include "instanceStream.h"
+#include "utils.h"
+#include "FILEtype.h"
+#include "instanceCache.h"
+#include "workerPool.h"
+#include "instanceIndex.h"
+#include "dataSource.h"
+
+#include <vector>
+
+/// The instances of a data file.
+/// The data file may be a pipe (the name "-" for the standard input, or a FIFO), which can be read only once.
+/// The first pass then spills the instances to a temporary binary cache (see InstanceCache) from which later
+/// passes, size() and seek() are served without parsing the text again.  A pass that stops before the end of
+/// the pipe is completed by reading the rest of the pipe into the spill when the stream is rewound.
+class InstanceFile : public InstanceStream
+{
+public:
+  typedef unsigned long long int LineCount; ///< a count of a number of instances
+  #define LCFMT "llu"
+
+  inline void testLineCount(LineCount &cnt) {
+    if (cnt == std::numeric_limits<LineCount>::max()) {
+      error("Line count exceeds system limit of %" LCFMT, std::numeric_limits<LineCount>::max());
+    }
+  }
+
+  InstanceFile(const char* metaFileName, const char* dataFileName);
+  ~InstanceFile(void);
+
+  void rewind();                                              ///< return to the first instance in the stream
+  bool advance();                                             ///< advance, discarding the next instance in the stream.  Return true iff successful.
+  bool advance(instance &inst);                               ///< advance to the next instance in the stream.  Return true iff successful. @param inst the instance record to receive the new instance. 
+  bool isAtEnd();                                             ///< true if we have advanced past the last instance
+  InstanceCount size();                                       ///< the number of instances in the stream.  This may require a pass through the stream to determine so should be used only if absolutely necessary.
+  bool seek(const InstanceCount inst);                        ///< position the stream so that the next advance returns instance inst.  Return false iff the stream has fewer instances.
+  bool canAdvanceDiscretised();                               ///< true iff advanceDiscretised is supported, which it is for Gigal format files
+  bool advanceDiscretised(instance &inst, const Cuts &cuts);  ///< advance to the next instance, discretising each numeric value as it is parsed.  Return true iff successful.
+  void setProjection(const std::vector<bool> &catAtts, const std::vector<bool> &numAtts);  ///< pass over the values of the attributes that are not flagged without parsing them, unless a cache is being written
+  bool sample(const InstanceCount n, const bool approximate, std::vector<instance> &insts);  ///< if approximate, parse the lines that start at n random byte offsets of a plain file, otherwise seek to the instances a pass would sample
+
+  // InstanceFile specific methods
+  void resetSource(const char* name);                                 ///< change the source file from which the data are read
+  void setMemoryMapped(const bool mapped);                            ///< read the data file through a memory mapping rather than through buffered reads
+  void setCaching(const bool caching);                                ///< serve passes after the first from a binary cache (the data file name + ".gbin") written during the first pass
+  void setThreads(const unsigned int n);                              ///< parse the data file in chunks on n threads
+  void setReadAhead(const bool readAhead);                            ///< read the data file on a background thread while it is parsed
+  void printIOStats();                                                ///< print the amount of data read, the read rate and the time spent waiting for data
+
+private:
+  /// an error in the data file.  It is thrown by the parser so that errors found by worker threads can be reported in file order.
+  class ParseError {
+  public:
+    ParseError(const char *fmt, ...);
+    char msg[512];  ///< the error message
+  };
+
+  class ioMetadata : public InstanceStream::MetaData {
+  public:
+    ioMetadata(const bool case_sensitive = true);
+    ~ioMetadata(void);
+
+    unsigned int getNoClasses() const;                          ///< return the number of classes
+    const char* getClassName(CatValue y) const;   ///< return the name for a class
+    const char* getClassAttName() const;                        ///< return the name for the class attribute
+    unsigned int getNoCatAtts() const;                          ///< return the number of categorical attributes
+    unsigned int getNoValues(CategoricalAttribute att) const;   ///< return the number of values for a categorical Attribute
+    const char* getCatAttName(CategoricalAttribute att) const;  ///< return the name for a categorical Attribute
+    const char* getCatAttValName(CategoricalAttribute att, CatValue val) const; ///< return the name for a categorical Attribute value
+    unsigned int getNoNumAtts() const;                          ///< return the number of numeric attributes
+    const char* getNumAttName(CategoricalAttribute att) const;  ///< return the name for a numeric Attribute
+    unsigned int getPrecision(NumericAttribute att) const;         ///< return the precision to which values of a numeric attribute should be output
+    int hasCatMissing(CategoricalAttribute att) const;          ///<  return whether a categorical attribute contains missing values
+    int hasNumMissing(NumericAttribute att) const;          ///<  return whether a numeric attribute contains missing values
+    const char* getName();                                      ///< return a string that gives a meaningful name for the stream
+    bool areNamesCaseSensitive();                               ///< true iff name comparisons are case sensitive
+    void setAllAttsMissing();
+
+    static const int MAX_NAME_LENGTH = 200;
+
+    typedef unsigned int Attribute;   
+
+    void parse(const char* fn);         ///< parse a metadata file
+
+    /// an open addressing hash table from the names of the values of an attribute to their indexes
+    class ValueTable {
+    public:
+      void init(const std::vector<char *> &names, const bool caseSensitive);  ///< build the table for a set of value names
+      /// the index of the value with a given name, or NOVALUE if there is none
+      inline CatValue find(const char *name) const {
+        for (unsigned int s = hash(name, caseSensitive_) & mask_; slots_[s] != NOVALUE; s = (s + 1) & mask_) {
+          if (streq(name, (*names_)[slots_[s]], caseSensitive_)) return slots_[s];
+        }
+        return NOVALUE;
+      }
+
+      static const CatValue NOVALUE = 0xFFFFFFFF;  ///< the result of find for a name that is not a value
+
+    private:
+      /// FNV-1a hash of a name, ignoring case if the names are not case sensitive
+      static inline unsigned int hash(const char *name, const bool caseSensitive) {
+        unsigned int h = 2166136261U;
+        if (caseSensitive) {
+          while (*name != '\0') h = (h ^ static_cast<unsigned char>(*name++)) * 16777619U;
+        }
+        else {
+          while (*name != '\0') h = (h ^ static_cast<unsigned char>(tolower(*name++))) * 16777619U;
+        }
+        return h;
+      }
+
+      const std::vector<char *> *names_;  ///< the value names
+      std::vector<CatValue> slots_;       ///< the index of the value held in each slot, or NOVALUE if it is empty
+      unsigned int mask_;                 ///< the number of slots - 1
+      bool caseSensitive_;                ///< true iff the names are case sensitive
+    };
+
+    /// read a categorical value from a buffer
+    inline CatValue readCatVal(const char *&p, const char *end, const Attribute att, const LineCount line) const {
+      return readVal(p, end, colWidth[att], attValTables[internalAtt[att]], attNames[att], line);
+    }
+
+    /// read a class from a buffer
+    virtual CatValue readClass(const char *&p, const char *end, const LineCount line, const char delimiter = ',') const;
+    
+    /// read a number, which may be in scientific format
+    NumValue readNum(const char *&p, const char *end, const NumericAttribute att, std::vector<unsigned int> &attPrecision) const;
+
+    inline unsigned int noOfClasses() const { return classNames_.size(); }
+    inline unsigned int noOfAttributes() const { return attNames.size(); }
+
+    std::vector<AttType> attTypes;  ///< the type of each Attribute
+    std::vector<unsigned int> colWidth;   ///< the width of a fixed width column.  0 for variable width delimited fields
+    std::vector<unsigned int> precision;  ///< the precision to which a numeric value is specified
+    std::vector<char *> attNames;         ///< the name of each Attribute
+    std::vector<std::vector<char *> > attValNames;  ///< the names of the values for each categorical Attribute
+    std::vector<ValueTable> attValTables;  ///< the hash tables for looking up the values of each categorical Attribute
+    ValueTable classTable_;             ///< the hash table for looking up the classes
+    std::vector<int> missingVals;       ///< whether an attribute has o not missing values 
+    std::vector<char *> classNames_;     ///< the names of each class
+    std::vector<Attribute> internalAtt; ///< a map from the io Attribute index to the categorical or numeric Attribute index
+    std::vector<Attribute> cat2io;      ///< a map from categorical Attribute indexes to io indexes
+    std::vector<Attribute> num2io;      ///< a map from numeric Attribute indexes to io indexes
+    Attribute class2io;                 ///< the io index of the class
+    const bool caseSensitive;           /// true iff the input file is case sensitive
+
+    typedef enum {gigal_FORMAT, LIBSVM_FORMAT} InputFormat;
+    InputFormat inputFormat_;        ///< is the file in Gigal or libSVM format
+    char const* filename;  ///< the name of the file
+
+  protected:
+    /// read a categorical value from the input buffer
+    CatValue readVal(const char *&p, const char *end, const unsigned int colWidth, const ValueTable &values, const char* attName, LineCount line, const char delimiter = ',') const;
+    
+    /// get a categorical value from a string
+    CatValue getVal(const char *valname, const std::vector<char *> &valNames, const char *attname) const;
+
+  private: 
+    /// read the next delimted token from the metadata file
+    void readName(FILEtype *f, char *buffer, const char terminator, int &c) const;
+    
+    /// read the next delimted token from the input buffer
+    void readName(const char *&p, const char *end, char *buffer, const char terminator) const;
+    
+    /// read the next fixed width token from the input buffer
+    void readFWName(const char *&p, const char *end, char *buffer, const unsigned int width) const;
+  };
+
+  void openSource();     ///< open the data file named in the metadata
+  void closeSource();    ///< release the data file and its buffer or mapping
+  bool fill();           ///< read more of the data file into the buffer, preserving the unread data.  Return false iff there is no more data
+  void bufferRecord();   ///< ensure that the buffer holds the whole of the current line
+  void startCache();     ///< open the binary cache if it is up to date, otherwise start writing it.  For a pipe, start writing the spill.
+  void spillRest();      ///< read the rest of a pipe into the spill, completing it
+  bool skipLine();       ///< skip the next line of the data file without parsing it.  Return true iff successful.
+  bool loadIndex();      ///< load the index of the data file.  Return false if it does not exist or is out of date.
+  void buildIndex();     ///< build the index of the data file and save it
+  bool sampleBySeek(const InstanceCount n, std::vector<instance> &insts);  ///< the exact sample of n instances, read by seeking to each instance that a pass would select
+  bool readInstance(instance &inst, const Cuts *cuts = NULL);  ///< parse the next instance from the data file, discretising its numeric values by cuts if it is not NULL.  Return true iff successful.
+  /// parse an instance from a buffer holding whole lines, updating the line count and the precision of each numeric attribute
+  bool parseInstance(const char *&p, const char *end, LineCount &lineNo, std::vector<unsigned int> &attPrecision, instance &inst, const Cuts *cuts = NULL);
+  void skipValue(const char *&p, const char *end, const unsigned int att) const;  ///< pass over the value of an attribute that is not projected
+  unsigned long long offsetOf(const char *p);  ///< the offset in the data file of a position in the buffer or mapping
+  void moveTo(const unsigned long long offset);  ///< position the buffer or mapping at an offset in the data file, reusing the data in the buffer if it holds the offset
+
+  /// a range of the data file that is parsed by one thread
+  struct ParseChunk {
+    const char *begin;                  ///< the start of the chunk
+    const char *end;                    ///< the end of the chunk, which is the end of a line
+    std::vector<instance> insts;        ///< the instances parsed from the chunk
+    InstanceCount count;                ///< the number of instances parsed from the chunk
+    LineCount lines;                    ///< the number of lines spanned by the chunk
+    std::vector<unsigned int> precision;  ///< the precision of each numeric attribute in the chunk
+    bool failed;                        ///< true iff the chunk contains an error
+  };
+
+  /// parses the chunks of a window of the data file in parallel
+  class ChunkParser : public WorkerPool::Task {
+  public:
+    ChunkParser(InstanceFile &file) : file_(file) {}
+    void run(const unsigned int worker) { file_.parseChunk(file_.chunks_[worker]); }
+  private:
+    InstanceFile &file_;
+  };
+
+  void parseChunk(ParseChunk &chunk);   ///< parse all the instances in a chunk
+  bool parseWindow();                   ///< parse the next window of the data file in parallel.  Return false iff there is no more data
+  bool readParsed(instance *inst);      ///< take the next instance parsed in parallel, discarding it if inst is NULL.  Return true iff successful.
+  const instance *nextParsed();         ///< take the next instance parsed in parallel.  Return NULL if there are no more.
+  bool parsedRemaining() const;         ///< true iff instances parsed in parallel remain to be read
+
+  /// true iff there is at least one more character to read, filling the buffer if necessary
+  inline bool more() { return pos_ < end_ || fill(); }
+
+  DataSource source_;         ///< the data file, when it is not memory mapped
+  bool memoryMapped_;         ///< true iff the data file should be read through a memory mapping
+  bool mapped_;               ///< true iff the data file is read through a memory mapping.  A compressed file cannot be
+  char *map_;                 ///< the memory mapping of the data file
+  size_t mapSize_;            ///< the size of the memory mapping
+  std::vector<char> buffer_;  ///< the buffer into which the data file is read when it is not memory mapped
+  const char *pos_;           ///< the next character to read from the buffer or mapping
+  const char *end_;           ///< the end of the data in the buffer or mapping
+  bool atEOF_;                ///< true iff end_ is the end of the data file
+  bool caching_;              ///< true iff a binary cache of the data file is used
+  bool streaming_;            ///< true iff the data file is a pipe, whose instances are spilled to a temporary binary cache
+  InstanceCache cache_;       ///< the binary cache of the data file
+  instance cacheInst_;        ///< receives the instances that are skipped while the cache is written
+  std::vector<bool> skip_;    ///< for each attribute of the file, true iff its values are passed over.  Empty if every attribute is read
+  InstanceIndex index_;       ///< the positions of the instances in the data file
+  WorkerPool *pool_;          ///< the threads that parse the data file.  NULL if it is parsed by the calling thread
+  std::vector<ParseChunk> chunks_;  ///< the chunks of the window of the data file that has been parsed in parallel
+  unsigned int chunk_;        ///< the chunk from which the next instance is read
+  InstanceCount next_;        ///< the next instance to read within the chunk
+  size_t chunkSize_;          ///< the number of bytes each thread parses in the next window
+  ioMetadata metadata_; ///< the metadata for the file
+  LineCount line;        ///< the current input line
+};
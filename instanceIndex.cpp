@@ -0,0 +1,173 @@
+/* Open source system for classification learning from very large data
+** Class for a sparse index of the positions of the instances in a data file
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "instanceIndex.h"
+#include "dataSource.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char INDEX_MAGIC[4] = {'G', 'I', 'D', 'X'};
+static const unsigned int INDEX_VERSION = 1;
+
+InstanceIndex::InstanceIndex() : valid_(false), sourceSize_(0), sourceTime_(0), count_(0)
+{
+}
+
+InstanceIndex::~InstanceIndex(void)
+{
+}
+
+bool InstanceIndex::load(const char *indexName, const char *sourceName) {
+  valid_ = false;
+
+  struct stat buf;
+
+  if (stat(sourceName, &buf) != 0) return false;
+
+  FILE *f = fopen(indexName, "rb");
+
+  if (f == NULL) return false;
+
+  char magic[sizeof(INDEX_MAGIC)];
+  unsigned int version;
+  unsigned int interval;
+  unsigned long long count;
+  unsigned long long noEntries;
+
+  bool ok = fread(magic, 1, sizeof(magic), f) == sizeof(magic) && memcmp(magic, INDEX_MAGIC, sizeof(magic)) == 0
+         && fread(&version, sizeof(version), 1, f) == 1 && version == INDEX_VERSION
+         && fread(&sourceSize_, sizeof(sourceSize_), 1, f) == 1 && sourceSize_ == static_cast<unsigned long long>(buf.st_size)
+         && fread(&sourceTime_, sizeof(sourceTime_), 1, f) == 1 && sourceTime_ == static_cast<long long>(buf.st_mtime)
+         && fread(&interval, sizeof(interval), 1, f) == 1 && interval == INTERVAL
+         && fread(&count, sizeof(count), 1, f) == 1
+         && fread(&noEntries, sizeof(noEntries), 1, f) == 1;
+
+  if (ok) {
+    offset_.resize(noEntries);
+    line_.resize(noEntries);
+    ok = noEntries == 0 || (fread(&offset_[0], sizeof(offset_[0]), noEntries, f) == noEntries
+                            && fread(&line_[0], sizeof(line_[0]), noEntries, f) == noEntries);
+  }
+
+  fclose(f);
+
+  if (ok) {
+    count_ = static_cast<InstanceCount>(count);
+    valid_ = true;
+  }
+
+  return ok;
+}
+
+// instances are counted in the same way as InstanceFile::advance(), which skips lines containing only non-printable characters.
+// the line count is maintained in the same way as when instances are read, so that error messages give the same line numbers.
+void InstanceIndex::build(const char *sourceName) {
+  struct stat buf;
+
+  if (stat(sourceName, &buf) != 0) error("Cannot open input file %s", sourceName);
+
+  sourceSize_ = buf.st_size;
+  sourceTime_ = buf.st_mtime;
+
+  DataSource source;
+
+  source.open(sourceName);
+
+  std::vector<char> buffer(1 << 20);
+  unsigned long long offset = 0;  // the offset of the start of the buffer
+  unsigned long long line = 0;
+  bool inLine = false;
+  size_t n;
+
+  count_ = 0;
+  offset_.clear();
+  line_.clear();
+
+  while ((n = source.read(&buffer[0], buffer.size())) != 0) {
+    for (size_t i = 0; i < n; i++) {
+      const unsigned char c = buffer[i];
+
+      if (inLine) {
+        if (c == '\n' || c == '\r') inLine = false;  // the terminator is consumed with the line
+      }
+      else if (c <= ' ') {
+        if (c == '\n') line++;
+      }
+      else {
+        if (count_ % INTERVAL == 0) {
+          offset_.push_back(offset + i);
+          line_.push_back(line);
+        }
+        count_++;
+        line++;
+        inLine = true;
+      }
+    }
+
+    offset += n;
+  }
+
+  source.close();
+
+  valid_ = true;
+}
+
+bool InstanceIndex::save(const char *indexName) const {
+  FILE *f = fopen(indexName, "wb");
+
+  if (f == NULL) return false;
+
+  const unsigned int version = INDEX_VERSION;
+  const unsigned int interval = INTERVAL;
+  const unsigned long long count = count_;
+  const unsigned long long noEntries = offset_.size();
+
+  fwrite(INDEX_MAGIC, 1, sizeof(INDEX_MAGIC), f);
+  fwrite(&version, sizeof(version), 1, f);
+  fwrite(&sourceSize_, sizeof(sourceSize_), 1, f);
+  fwrite(&sourceTime_, sizeof(sourceTime_), 1, f);
+  fwrite(&interval, sizeof(interval), 1, f);
+  fwrite(&count, sizeof(count), 1, f);
+  fwrite(&noEntries, sizeof(noEntries), 1, f);
+  if (noEntries) {
+    fwrite(&offset_[0], sizeof(offset_[0]), noEntries, f);
+    fwrite(&line_[0], sizeof(line_[0]), noEntries, f);
+  }
+
+  const bool ok = ferror(f) == 0;
+
+  fclose(f);
+
+  if (!ok) remove(indexName);
+
+  return ok;
+}
+
+void InstanceIndex::find(const InstanceCount inst, unsigned long long &offset, unsigned long long &line, InstanceCount &skip) const {
+  assert(valid_ && inst < count_);
+
+  const size_t entry = inst / INTERVAL;
+
+  offset = offset_[entry];
+  line = line_[entry];
+  skip = inst - static_cast<InstanceCount>(entry) * INTERVAL;
+}
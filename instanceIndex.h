@@ -0,0 +1,56 @@
+/* Open source system for classification learning from very large data
+** Class for a sparse index of the positions of the instances in a data file
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "instanceStream.h"
+
+#include <vector>
+
+/// A sparse index of a data file.  It records the number of instances in the file and the byte offset (within the
+/// decompressed data if the file is compressed) and line number of every INTERVAL'th instance, so that a reader can
+/// start at any instance by skipping fewer than INTERVAL lines.
+/// The index is saved in a sidecar file (the data file name + ".idx") together with the size and modification time
+/// of the data file, and is only loaded while these are unchanged.
+class InstanceIndex
+{
+public:
+  InstanceIndex();
+  ~InstanceIndex(void);
+
+  bool load(const char *indexName, const char *sourceName);  ///< load an index.  Return false if it does not exist or is out of date.
+  void build(const char *sourceName);                        ///< build the index by scanning a data file
+  bool save(const char *indexName) const;                    ///< save the index.  Return false if it cannot be written.
+
+  inline bool isValid() const { return valid_; }            ///< true iff the index has been loaded or built
+  inline InstanceCount size() const { return count_; }      ///< the number of instances in the data file
+
+  /// the offset and line number of the indexed instance at or before an instance, and the number of instances that lie between them
+  void find(const InstanceCount inst, unsigned long long &offset, unsigned long long &line, InstanceCount &skip) const;
+
+  static const unsigned int INTERVAL = 4096;  ///< the number of instances between indexed positions
+
+private:
+  bool valid_;                               ///< true iff the index has been loaded or built
+  unsigned long long sourceSize_;            ///< the size of the data file
+  long long sourceTime_;                     ///< the modification time of the data file
+  InstanceCount count_;                      ///< the number of instances in the data file
+  std::vector<unsigned long long> offset_;   ///< the byte offset of every INTERVAL'th instance
+  std::vector<unsigned long long> line_;     ///< the line count before every INTERVAL'th instance
+};
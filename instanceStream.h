@@ -1,116 +1,237 @@
-/* Open source system for classification learning from very large data
-** Class for an input source for instances
-** Copyright (C) 2012 Geoffrey I Webb
-**
-** This program is free software: you can redistribute it and/or modify
-** it under the terms of the GNU General Public License as published by
-** the Free Software Foundation, either version 3 of the License, or
-** (at your option) any later version.
-** 
-** This program is distributed in the hope that it will be useful,
-** but WITHOUT ANY WARRANTY; without even the implied warranty of
-** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
-** GNU General Public License for more details.
-** 
-** You should have received a copy of the GNU General Public License
-** along with this program. If not, see <http://www.gnu.org/licenses/>.
-**
-** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
-*/
-#pragma once
-
-#include "instance.h"
-
-#include <assert.h>
-
-
-#ifdef SIXTYFOURBITCOUNTS
-typedef unsigned long long int InstanceCount; // a count of a number of instances
-#define ICFMT "llu"
-#else  // SIXTYFOURBITCOUNTS
-typedef unsigned int InstanceCount; // a count of a number of instances
-#define ICFMT "u"
-#endif // SIXTYFOURBITCOUNTS
-
-
-class InstanceStream
-{
-public:
-  InstanceStream();
-  ~InstanceStream(void);
-
-  virtual void rewind() = 0;                                              ///< return to the first instance in the stream
-  virtual bool advance() = 0;                                             ///< advance, discarding the next instance in the stream.  Return true iff successful.
-  virtual bool advance(instance &inst) = 0;                               ///< advance to the next instance in the stream.  Return true iff successful. @param inst the instance record to receive the new instance. 
-  virtual bool isAtEnd() = 0;                                             ///< true if we have advanced past the last instance
-  virtual InstanceCount size() = 0;                                       ///< the number of instances in the stream. This may require a pass through the stream to determine so should be used only if absolutely necessary.  The stream state is undefined after a call to size(), so a rewind shouldbe performed before the next advance.
-  
-  class MetaData {
-  public:
-    virtual unsigned int getNoClasses() const = 0;                          ///< return the number of classes
-    virtual const char* getClassName(CatValue att) const = 0;               ///< return the name for a class
-    virtual const char* getClassAttName() const = 0;                        ///< return the name for the class attribute
-    virtual unsigned int getNoCatAtts() const = 0;                          ///< return the number of categorical attributes
-    virtual int hasCatMissing(CategoricalAttribute att) const = 0;          ///< return whether a categorical attribute contains missing values
-    virtual int hasNumMissing(NumericAttribute att) const = 0;              ///< return whether a numeric attribute contains missing values
-    virtual unsigned int getNoValues(CategoricalAttribute att) const = 0;   ///< return the number of values for a categorical attribute
-    virtual const char* getCatAttName(CategoricalAttribute att) const = 0;  ///< return the name for a categorical Attribute
-    virtual const char* getCatAttValName(CategoricalAttribute att, CatValue val) const = 0; ///< return the name for a categorical attribute value
-    virtual unsigned int getNoNumAtts() const = 0;                          ///< return the number of numeric attributes
-    virtual const char* getNumAttName(NumericAttribute att) const = 0;      ///< return the name for a numeric attribute
-    virtual unsigned int getPrecision(NumericAttribute att) const = 0;      ///< return the precision to which values of a numeric attribute should be output
-    virtual const char* getName() = 0;                                      ///< return a string that gives a meaningful name for the stream
-    virtual bool areNamesCaseSensitive() = 0;                               ///< true iff name comparisons are case sensitive
-    virtual void setAllAttsMissing() = 0;
-  };
-
-  class MetaDataFilter : public MetaData {
-  public:
-    virtual unsigned int getNoClasses() const;                          ///< return the number of classes
-    virtual const char* getClassName(CatValue att) const;               ///< return the name for a class
-    virtual const char* getClassAttName() const ;                        ///< return the name for the class attribute
-    virtual unsigned int getNoCatAtts() const;                          ///< return the number of categorical attributes
-    virtual int hasCatMissing(CategoricalAttribute att) const;          ///< return whether a categorical attribute contains missing values
-    virtual int hasNumMissing(NumericAttribute att) const;              ///< return whether a numeric attribute contains missing values
-    virtual unsigned int getNoValues(CategoricalAttribute att) const;   ///< return the number of values for a categorical attribute
-    virtual const char* getCatAttName(CategoricalAttribute att) const;  ///< return the name for a categorical Attribute
-    virtual const char* getCatAttValName(CategoricalAttribute att, CatValue val) const; ///< return the name for a categorical attribute value
-    virtual unsigned int getNoNumAtts() const;                          ///< return the number of numeric attributes
-    virtual const char* getNumAttName(NumericAttribute att) const;      ///< return the name for a numeric attribute
-    virtual unsigned int getPrecision(NumericAttribute att) const;      ///< return the precision to which values of a numeric attribute should be output
-    virtual const char* getName();                                      ///< return a string that gives a meaningful name for the stream
-    virtual bool areNamesCaseSensitive();                               ///< true iff name comparisons are case sensitive
-    virtual void setAllAttsMissing(); 
-
-    inline void setSource(MetaData* source) { source_ = source; }
-
-  protected:
-    MetaData* source_;
-  };
-
-  inline MetaData* getMetaData() const { return metaData_; }
-  void printMetadata(const char* filename) const;                         /// print a Gigal metadatafile for the stream
-
-  inline unsigned int getNoClasses() const { return metaData_->getNoClasses(); }                         ///< return the number of classes
-  inline const char* getClassName(CatValue att) const { return metaData_->getClassName(att); }              ///< return the name for a class
-  inline const char* getClassAttName() const { return metaData_->getClassAttName(); }                       ///< return the name for the class attribute
-  inline unsigned int getNoCatAtts() const { return metaData_->getNoCatAtts(); }                         ///< return the number of categorical attributes
-  inline int hasCatMissing(CategoricalAttribute att) const { return metaData_->hasCatMissing(att); }      ///< return whether a categorical attribute contains missing values
-  inline int hasNumMissing(NumericAttribute att) const { return metaData_->hasNumMissing(att); }          ///< return whether a numeric attribute contains missing values
-  inline unsigned int getNoValues(CategoricalAttribute att) const { return metaData_->getNoValues(att); }  ///< return the number of values for a categorical attribute
-  inline const char* getCatAttName(CategoricalAttribute att) const { return metaData_->getCatAttName(att); } ///< return the name for a categorical Attribute
-  inline const char* getCatAttValName(CategoricalAttribute att, CatValue val) const { return metaData_->getCatAttValName(att, val); } ///< return the name for a categorical attribute value
-  inline unsigned int getNoNumAtts() const { return metaData_->getNoNumAtts(); }                         ///< return the number of numeric attributes
-  inline const char* getNumAttName(NumericAttribute att) const { return metaData_->getNumAttName(att); }     ///< return the name for a numeric attribute
-  inline unsigned int getPrecision(NumericAttribute att) const { return metaData_->getPrecision(att); }     ///< return the precision to which values of a numeric attribute should be output
-  inline const char* getName() { return metaData_->getName(); }                                     ///< return a string that gives a meaningful name for the stream
-  inline bool areNamesCaseSensitive() { return metaData_->areNamesCaseSensitive(); }  
-  inline void setAllAttsMissing() {metaData_->setAllAttsMissing(); }
-
-protected:
-  inline void setCatVal(instance &inst, const CategoricalAttribute att, const CatValue v) { inst.setCatVal(att, v); }
-  inline void setNumVal(instance &inst, const NumericAttribute att, const NumValue v) { inst.setNumVal(att, v); }
-  inline void setClass(instance &inst, const CatValue v) { inst.setClass(v); }
-
-  MetaData* metaData_;
-};
+/* Open source system for classification learning from very large data
+** Class for an input source for instances
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "instance.h"
+
+#include <algorithm>
+#include <assert.h>
+
+
+// a count of a number of instances.  The tables of counts choose the width of their counts as they grow (see xxyDist, xyDist and dtNode),
+// so a count is always 64 bits and there is no limit on the number of instances to build in.
+typedef unsigned long long int InstanceCount;
+#define ICFMT "llu"
+
+
+class InstanceBatch;
+class BitmapIndex;
+class WorkerPool;
+class xxyDist;
+
+class InstanceStream
+{
+public:
+  InstanceStream();
+  ~InstanceStream(void);
+
+  virtual void rewind() = 0;                                              ///< return to the first instance in the stream
+  virtual bool advance() = 0;                                             ///< advance, discarding the next instance in the stream.  Return true iff successful.
+  virtual bool advance(instance &inst) = 0;                               ///< advance to the next instance in the stream.  Return true iff successful. @param inst the instance record to receive the new instance. 
+  virtual bool isAtEnd() = 0;                                             ///< true if we have advanced past the last instance
+  virtual InstanceCount size() = 0;                                       ///< the number of instances in the stream. This may require a pass through the stream to determine so should be used only if absolutely necessary.  The stream state is undefined after a call to size(), so a rewind shouldbe performed before the next advance.
+  virtual bool seek(const InstanceCount inst);                            ///< position the stream so that the next advance returns instance inst (counting from 0).  Return false iff the stream has fewer instances.  The default rewinds and skips the preceding instances.
+
+  /// advance over up to n instances (no more than the capacity of the batch), storing them in the batch.  Return the number stored, which is less than n only at the end of the stream.
+  /// The default stores each instance in turn from advance(instance&).
+  virtual unsigned int advance(InstanceBatch &batch, const unsigned int n);
+
+  typedef std::vector<std::vector<NumValue> > Cuts;                       ///< the cuts that divide the values of each numeric attribute into intervals
+
+  virtual bool canAdvanceDiscretised();                                   ///< true iff the stream supports advanceDiscretised.  The default is false.
+  /// advance to the next instance, writing each numeric attribute a as categorical attribute getNoCatAtts()+a, discretised by cuts[a].
+  /// This lets a discretiser take its instances without an intermediate copy.  Return true iff successful.  Only supported if canAdvanceDiscretised().
+  virtual bool advanceDiscretised(instance &inst, const Cuts &cuts);
+
+  /// the interval into which cuts divide a numeric value: the number of cuts less than it, or cuts.size()+1 if it is missing
+  static inline CatValue discretiseValue(const NumValue val, const std::vector<NumValue> &cuts) {
+    if (val == MISSINGNUM) {
+      return cuts.size() + 1;
+    } else if (cuts.size() == 0) {
+      return 0;
+    } else if (val > cuts.back()) {
+      return cuts.size();
+    } else {
+      unsigned int upper = cuts.size() - 1;
+      unsigned int lower = 0;
+
+      while (upper > lower) {
+        const unsigned int mid = lower + (upper - lower) / 2;
+
+        if (val <= cuts[mid]) {
+          upper = mid;
+        } else {
+          lower = mid + 1;
+        }
+      }
+
+      assert(upper == lower);
+      return upper;
+    }
+  }
+
+  /// The mapping by which a chain of filters, each of which maps every instance of its source to one instance, derives
+  /// each of its instances from an instance of the base stream beneath the chain.  FilterSet composes the mappings of
+  /// such filters so that InstanceStreamTransform can apply the whole chain in one step.
+  class Transform {
+  public:
+    /// where a categorical attribute takes its value from: a categorical attribute of the base, copied,
+    /// or a numeric attribute of the base, discretised by cuts
+    struct CatSource {
+      CatSource(const unsigned int a, const std::vector<NumValue> *c) : att(a), cuts(c) {}
+
+      unsigned int att;                    ///< the attribute of the base
+      const std::vector<NumValue> *cuts;   ///< the cuts that discretise a numeric attribute, or NULL if att is categorical
+    };
+
+    void init(InstanceStream &base);       ///< start with the identity mapping of the instances of base
+    bool keepsAtts() const;                ///< true iff the attributes are still exactly those of the base
+
+    std::vector<CatSource> catFrom;        ///< where each categorical attribute takes its value from
+    std::vector<NumericAttribute> numFrom; ///< the numeric attribute of the base that each numeric attribute copies
+    std::vector<CatValue> classMap;        ///< the class for each class of the base
+    const Cuts *allCuts;                   ///< if the attributes are those of the base with every numeric attribute discretised in turn, their cuts, otherwise NULL
+
+  private:
+    unsigned int baseNoCatAtts_;           ///< the number of categorical attributes of the base
+    unsigned int baseNoNumAtts_;           ///< the number of numeric attributes of the base
+  };
+
+  virtual InstanceStream *getTransformSource();                           ///< the source of a filter that maps each instance of its source to one instance, which can therefore be fused with its neighbours.  The default, NULL, means the stream cannot be fused.
+  virtual void composeTransform(Transform &t) const;                      ///< compose the mapping of the stream onto t, which maps a base stream to the instances of getTransformSource().  Only supported if getTransformSource() is not NULL.
+
+  /// read only the categorical and numeric attributes flagged in catAtts and numAtts until the projection is changed, so that
+  /// a reader can pass over the values of the others without parsing them.  The values of the attributes that are not flagged
+  /// are then undefined.  Empty flags select every attribute of their type.  The default ignores the projection.
+  virtual void setProjection(const std::vector<bool> &catAtts, const std::vector<bool> &numAtts);
+
+  /// a sample of the instances of the stream for a filter that is trained from a sample, such as a discretiser, taken without a pass
+  /// through the stream.  The sample is the reservoir of up to n instances that a pass drawing from MTRand_int32 with its default
+  /// seed would select.  If approximate is true a stream may instead read about n instances from random positions.  Return false,
+  /// leaving the stream's position undefined, if the stream cannot provide the sample, in which case the caller must take it by a
+  /// pass through the stream.  The default returns false.
+  virtual bool sample(const InstanceCount n, const bool approximate, std::vector<instance> &insts);
+
+  /// a bitmap index of the instances of the stream, numbered in the order the stream returns them, or NULL if the stream does not
+  /// keep one.  The stream's position is then undefined.  The default is NULL.
+  virtual BitmapIndex *getBitmapIndex();
+
+  /// update dist from the instances of the stream without a pass, the workers of pool, if it is not NULL, sharing the pairs of
+  /// attributes.  Return false, leaving dist unchanged, if the stream cannot, in which case the caller must update it by a pass.
+  /// The stream's position is then undefined.  The default counts the pairs from getBitmapIndex(), if the stream keeps an index.
+  virtual bool countPairs(xxyDist &dist, WorkerPool *pool);
+  
+  class MetaData {
+  public:
+    virtual unsigned int getNoClasses() const = 0;                          ///< return the number of classes
+    virtual const char* getClassName(CatValue att) const = 0;               ///< return the name for a class
+    virtual const char* getClassAttName() const = 0;                        ///< return the name for the class attribute
+    virtual unsigned int getNoCatAtts() const = 0;                          ///< return the number of categorical attributes
+    virtual int hasCatMissing(CategoricalAttribute att) const = 0;          ///< return whether a categorical attribute contains missing values
+    virtual int hasNumMissing(NumericAttribute att) const = 0;              ///< return whether a numeric attribute contains missing values
+    virtual unsigned int getNoValues(CategoricalAttribute att) const = 0;   ///< return the number of values for a categorical attribute
+    virtual const char* getCatAttName(CategoricalAttribute att) const = 0;  ///< return the name for a categorical Attribute
+    virtual const char* getCatAttValName(CategoricalAttribute att, CatValue val) const = 0; ///< return the name for a categorical attribute value
+    virtual unsigned int getNoNumAtts() const = 0;                          ///< return the number of numeric attributes
+    virtual const char* getNumAttName(NumericAttribute att) const = 0;      ///< return the name for a numeric attribute
+    virtual unsigned int getPrecision(NumericAttribute att) const = 0;      ///< return the precision to which values of a numeric attribute should be output
+    virtual const char* getName() = 0;                                      ///< return a string that gives a meaningful name for the stream
+    virtual bool areNamesCaseSensitive() = 0;                               ///< true iff name comparisons are case sensitive
+    virtual void setAllAttsMissing() = 0;
+  };
+
+  class MetaDataFilter : public MetaData {
+  public:
+    virtual unsigned int getNoClasses() const;                          ///< return the number of classes
+    virtual const char* getClassName(CatValue att) const;               ///< return the name for a class
+    virtual const char* getClassAttName() const ;                        ///< return the name for the class attribute
+    virtual unsigned int getNoCatAtts() const;                          ///< return the number of categorical attributes
+    virtual int hasCatMissing(CategoricalAttribute att) const;          ///< return whether a categorical attribute contains missing values
+    virtual int hasNumMissing(NumericAttribute att) const;              ///< return whether a numeric attribute contains missing values
+    virtual unsigned int getNoValues(CategoricalAttribute att) const;   ///< return the number of values for a categorical attribute
+    virtual const char* getCatAttName(CategoricalAttribute att) const;  ///< return the name for a categorical Attribute
+    virtual const char* getCatAttValName(CategoricalAttribute att, CatValue val) const; ///< return the name for a categorical attribute value
+    virtual unsigned int getNoNumAtts() const;                          ///< return the number of numeric attributes
+    virtual const char* getNumAttName(NumericAttribute att) const;      ///< return the name for a numeric attribute
+    virtual unsigned int getPrecision(NumericAttribute att) const;      ///< return the precision to which values of a numeric attribute should be output
+    virtual const char* getName();                                      ///< return a string that gives a meaningful name for the stream
+    virtual bool areNamesCaseSensitive();                               ///< true iff name comparisons are case sensitive
+    virtual void setAllAttsMissing(); 
+
+    inline void setSource(MetaData* source) { source_ = source; }
+
+  protected:
+    MetaData* source_;
+  };
+
+  inline MetaData* getMetaData() const { return metaData_; }
+  void printMetadata(const char* filename) const;                         /// print a Gigal metadatafile for the stream
+
+  inline unsigned int getNoClasses() const { return metaData_->getNoClasses(); }                         ///< return the number of classes
+  inline const char* getClassName(CatValue att) const { return metaData_->getClassName(att); }              ///< return the name for a class
+  inline const char* getClassAttName() const { return metaData_->getClassAttName(); }                       ///< return the name for the class attribute
+  inline unsigned int getNoCatAtts() const { return metaData_->getNoCatAtts(); }                         ///< return the number of categorical attributes
+  inline int hasCatMissing(CategoricalAttribute att) const { return metaData_->hasCatMissing(att); }      ///< return whether a categorical attribute contains missing values
+  inline int hasNumMissing(NumericAttribute att) const { return metaData_->hasNumMissing(att); }          ///< return whether a numeric attribute contains missing values
+  inline unsigned int getNoValues(CategoricalAttribute att) const { return metaData_->getNoValues(att); }  ///< return the number of values for a categorical attribute
+  inline const char* getCatAttName(CategoricalAttribute att) const { return metaData_->getCatAttName(att); } ///< return the name for a categorical Attribute
+  inline const char* getCatAttValName(CategoricalAttribute att, CatValue val) const { return metaData_->getCatAttValName(att, val); } ///< return the name for a categorical attribute value
+  inline unsigned int getNoNumAtts() const { return metaData_->getNoNumAtts(); }                         ///< return the number of numeric attributes
+  inline const char* getNumAttName(NumericAttribute att) const { return metaData_->getNumAttName(att); }     ///< return the name for a numeric attribute
+  inline unsigned int getPrecision(NumericAttribute att) const { return metaData_->getPrecision(att); }     ///< return the precision to which values of a numeric attribute should be output
+  inline const char* getName() { return metaData_->getName(); }                                     ///< return a string that gives a meaningful name for the stream
+  inline bool areNamesCaseSensitive() { return metaData_->areNamesCaseSensitive(); }  
+  inline void setAllAttsMissing() {metaData_->setAllAttsMissing(); }
+
+protected:
+  inline void setCatVal(instance &inst, const CategoricalAttribute att, const CatValue v) { inst.setCatVal(att, v); }
+  inline void setNumVal(instance &inst, const NumericAttribute att, const NumValue v) { inst.setNumVal(att, v); }
+  inline void setClass(instance &inst, const CatValue v) { inst.setClass(v); }
+
+  /// start writing the numeric values of a sparse row, after which every value not set by setSparseNumVal is 0.
+  /// If this stream wrote the instance's previous row sparsely, only the values in its pairs need to be reset.
+  inline void startSparse(instance &inst) const {
+    if (inst.sparseLayout == this) {
+      if (!inst.numVals.empty()) {
+        for (unsigned int i = 0; i < inst.nonZeroAtts.size(); i++) inst.numVals[inst.nonZeroAtts[i]] = 0;
+      }
+    }
+    else {
+      std::fill(inst.numVals.begin(), inst.numVals.end(), 0.0f);
+      inst.sparseLayout = this;
+    }
+    inst.nonZeroAtts.clear();
+    inst.nonZeroVals.clear();
+  }
+  /// set a numeric value of a sparse row.  An instance without numeric values (constructed by instance()) receives only the pair.
+  inline void setSparseNumVal(instance &inst, const NumericAttribute att, const NumValue v) const {
+    if (!inst.numVals.empty()) inst.numVals[att] = v;
+    inst.nonZeroAtts.push_back(att);
+    inst.nonZeroVals.push_back(v);
+  }
+  /// record that every value of the instance is being written
+  inline void setDense(instance &inst) const {
+    inst.sparseLayout = NULL;
+    inst.nonZeroAtts.clear();
+    inst.nonZeroVals.clear();
+  }
+
+  MetaData* metaData_;
+};
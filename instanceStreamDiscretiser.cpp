@@ -1,458 +1,616 @@
-#include "instanceStreamDiscretiser.h"
-#include "globals.h"
-#include "mtrand.h"
-#include "utils.h"
-
-// discretisers
-#include "eqDepthDiscretiser.h"
-#include "MDLDiscretiser.h"
-
-InstanceStreamDiscretiser::InstanceStreamDiscretiser(const char* name,
-		char* const *& argv, char* const * end) {
-	targetSampleSize_ = 100000;
-
-	if (streq(name, "equal-depth") || streq(name, "equal-frequency")) {
-		theDiscretiser = new eqDepthDiscretiser(argv, end);
-	} else if (streq(name, "mdl")) {
-		theDiscretiser = new MDLDiscretiser(argv, end);
-	}else {
-		error("Discretiser %s not supported", name);
-	}
-	printMetaData_ = false;
-	allNumWithMiss_ = false;
-	// get arguments
-	while (argv != end) {
-		if (**argv == '-' && argv[0][1] == 's') {
-			getUIntFromStr(argv[0] + 2, targetSampleSize_, "s");
-			++argv;
-		} else if (**argv == '-' && argv[0][1] == 'M') {
-			allNumWithMiss_ = true;
-			++argv;
-		} else if (**argv == '-' && argv[0][1] == 'P') {
-			printMetaData_ = true;
-			++argv;
-		} else if (argv[0][1] == 'o') {
-			filename_ = &argv[0][2];
-			++argv;
-		} else {
-			break;  // do not consume the remaining arguments
-		}
-	}
-
-	if (printMetaData_ == true && filename_ == NULL) {
-		error("The meta file for output must be specified by -o.\n");
-	}
-
-	if (theDiscretiser == NULL) {
-		theDiscretiser = new eqDepthDiscretiser(argv, end);
-	}
-
-}
-
-InstanceStreamDiscretiser::~InstanceStreamDiscretiser(void) {
-	delete theDiscretiser;
-}
-
-/// set the source for the filter
-void InstanceStreamDiscretiser::setSource(InstanceStream &src) {
-	std::vector<std::vector<NumValue> > vals;
-	std::vector<CatValue> classes;
-	InstanceCount count;
-	MTRand_int32 rand;
-
-	source_ = &src;
-	metaData_.setSource(src.getMetaData());
-
-	if (allNumWithMiss_)
-		metaData_.setAllAttsMissing();
-	InstanceStream::metaData_ = &metaData_;
-
-	// get the sample
-	vals.resize(src.getNoNumAtts());
-	for (NumericAttribute a = 0; a < src.getNoNumAtts(); a++) {
-		vals[a].resize(targetSampleSize_);
-	}
-	classes.resize(targetSampleSize_);
-
-	sourceInst_.init(src);
-	count = 0;
-
-	src.rewind();
-
-	instance inst(src);
-
-	while (src.advance(inst)) {
-		count++;  // keep track of the number of values seen
-		unsigned long index;
-
-		if (count <= targetSampleSize_) {
-			// if we have not yet got targetSampleSize_ examples, add this value to the end
-			index = count - 1;
-		} else {
-			// otherwise randomly determine whether to insert the value and where
-			index = rand(count);
-		}
-
-		if (index < targetSampleSize_) {
-			classes[index] = inst.getClass();
-			for (NumericAttribute a = 0; a < src.getNoNumAtts(); a++) {
-				vals[a][index] = inst.getNumVal(a);
-			}
-		}
-	}
-
-	metaData_.cuts.resize(src.getNoNumAtts());
-	metaData_.discAttValNames_.resize(src.getNoNumAtts());
-
-	if (classes.size() > count)
-		classes.resize(count);
-
-	char buf[200];
-
-	FILE * output;
-	if (printMetaData_) {
-		output = fopen(filename_, "w");
-	}
-
-	if (printMetaData_) {
-
-		for (CategoricalAttribute ca = 0; ca < src.getNoCatAtts(); ca++) {
-			fprintf(output, "%s: ", src.getCatAttName(ca));
-			if (verbosity >= 2)
-				printf("%s: ", src.getCatAttName(ca));
-
-			for (unsigned int i = 0; i < src.getNoValues(ca); i++) {
-
-				if (i !=  (src.getNoValues(ca)-1))
-					sprintf(buf, "%u, ", i);
-				else
-					sprintf(buf, "%u", i);
-
-				fprintf(output, "%s", buf);
-				if (verbosity >= 2) {
-					printf("%s", buf);
-				}
-			}
-
-		        fprintf(output, "\n");
-			if (verbosity >= 2)
-			  putchar('\n');
-
-		}
-
-
-
-		for (NumericAttribute na = 0; na < src.getNoNumAtts(); na++) {
-			if (vals[na].size() > count) {
-				// if fewer values than stored, truncate
-				vals[na].resize(count);
-			}
-			metaData_.cuts[na].clear();
-			// discretise then set up the value names
-			theDiscretiser->discretise(vals[na], classes, src.getNoClasses(),
-					metaData_.cuts[na]);
-
-			fprintf(output, "%s: ", src.getNumAttName(na));
-			if (verbosity >= 2)
-				printf("%s: ", src.getNumAttName(na));
-
-                        unsigned int i;
-			// loop through all of the intervals that have been formed (note, one more interval than cut)
-			for (i = 0; i <= metaData_.cuts[na].size(); i++) {
-
-				//sprintf(buf, "%u", i);
-				if (i != metaData_.cuts[na].size())
-					sprintf(buf, "%u, ", i);
-				else
-					sprintf(buf, "%u", i);
-
-				fprintf(output, "%s", buf);
-				if (verbosity >= 2) {
-					printf("%s", buf);
-				}
-			}
-
-			// add missing value
-			if (metaData_.hasNumMissing(na)) {
-                                sprintf(buf, ", %u ", i++);
-				fprintf(output, "%s\n", buf);
-				if (verbosity >= 2)
-					printf("%s\n", buf);
-
-			} else {
-				fprintf(output, "\n");
-				if (verbosity >= 2)
-					putchar('\n');
-			}
-
-		}
-
-
-
-		fprintf(output, "class: ");
-		const char *sep = "";
-		for (CatValue i = 0; i < src.getNoClasses(); i++) {
-			fprintf(output, "%s%u", sep, i);
-			sep = ", ";
-		}
-		fprintf(output, "\n");
-
-	}
-
-	else {
-
-		for (NumericAttribute na = 0; na < src.getNoNumAtts(); na++) {
-			if (vals[na].size() > count) {
-				// if fewer values than stored, truncate
-				vals[na].resize(count);
-			}
-			metaData_.cuts[na].clear();
-			// discretise then set up the value names
-			theDiscretiser->discretise(vals[na], classes, src.getNoClasses(),
-					metaData_.cuts[na]);
-			if (verbosity >= 3)
-				printf("Discretisation for %s: ", src.getNumAttName(na));
-			// loop through all of the intervals that have been formed (note, one more interval than cut)
-			for (unsigned int i = 0; i <= metaData_.cuts[na].size(); i++) {
-				if (i == 0) {
-					if (metaData_.cuts[na].size() == 0) {
-						sprintf(buf, "known");
-					} else {
-						// print values to precision+1 in case cut points are placed between actual values
-						sprintf(buf, "<=%.*f", src.getPrecision(na) + 1,
-								metaData_.cuts[na][i]);
-					}
-				} else if (i < metaData_.cuts[na].size()) {
-					// print values to precision+1 in case cut points are placed between actual values
-					sprintf(buf, "(%.*f,%.*f]", src.getPrecision(na) + 1,
-							metaData_.cuts[na][i - 1], src.getPrecision(na) + 1,
-							metaData_.cuts[na][i]);
-				} else {
-					// print values to precision+1 in case cut points are placed between actual values
-					sprintf(buf, ">%.*f", src.getPrecision(na) + 1,
-							metaData_.cuts[na][i - 1]);
-				}
-				if (verbosity >= 3) {
-					printf("%s ", buf);
-					if (i != metaData_.cuts[na].size())
-						printf(", ");
-				}
-				char *newbuf;
-				safeAlloc(newbuf, strlen(buf) + 1);
-				strcpy(newbuf, buf);
-				metaData_.discAttValNames_[na].push_back(newbuf);
-
-			}
-			// add missing value
-			if (metaData_.hasNumMissing(na)) {
-				const char *mstr;
-				mstr = ", unknown";
-				char *newbuf;
-				if (verbosity >= 3)
-					printf("%s\n", mstr);
-				safeAlloc(newbuf, strlen(mstr) + 1);
-				strcpy(newbuf, mstr);
-				metaData_.discAttValNames_[na].push_back(newbuf);
-			} else {
-				if (verbosity >= 3)
-					putchar('\n');
-			}
-		}
-
-	}
-
-	if (printMetaData_) {
-		fclose(output);
-	}
-	rewind();
-}
-
-/// return to the first instance in the stream
-void InstanceStreamDiscretiser::rewind() {
-	source_->rewind();
-}
-
-/// advance, discarding the next instance in the stream.  Return true iff successful.
-bool InstanceStreamDiscretiser::advance() {
-	return source_->advance();
-}
-
-CatValue InstanceStreamDiscretiser::discretise(const NumValue val,
-
-		const NumericAttribute na) const {
-
-	if (val == MISSINGNUM) {
-		return metaData_.cuts[na].size() + 1;
-	} else if (metaData_.cuts[na].size() == 0) {
-		return 0;
-	} else if (val > metaData_.cuts[na].back()) {
-		return metaData_.cuts[na].size();
-	} else {
-		unsigned int upper = metaData_.cuts[na].size() - 1;
-		unsigned int lower = 0;
-
-		while (upper > lower) {
-			const unsigned int mid = lower + (upper - lower) / 2;
-
-			if (val <= metaData_.cuts[na][mid]) {
-				upper = mid;
-			} else {
-				lower = mid + 1;
-			}
-		}
-
-		assert(upper == lower);
-		return upper;
-	}
-}
-
-void InstanceStreamDiscretiser::discretiseInstance(const instance &inst,
-		instance &instDisc) {
-	CategoricalAttribute ca;
-
-	for (ca = 0; ca < source_->getNoCatAtts(); ca++) {
-		setCatVal(instDisc, ca, inst.getCatVal(ca));
-	}
-
-	for (NumericAttribute na = 0; na < source_->getNoNumAtts(); na++) {
-		setCatVal(instDisc, ca, discretise(inst.getNumVal(na), na));
-		ca++;
-	}
-	instDisc.setClass(inst.getClass());
-}
-
-/// advance to the next instance in the stream. Return true iff successful. @param inst the instance record to receive the new instance. 
-bool InstanceStreamDiscretiser::advance(instance &inst) {
-
-	if (!source_->advance(sourceInst_))
-		return false;
-
-	setClass(inst, sourceInst_.getClass());
-
-	CategoricalAttribute ca;
-
-	for (ca = 0; ca < source_->getNoCatAtts(); ca++) {
-		setCatVal(inst, ca, sourceInst_.getCatVal(ca));
-	}
-
-	NumericAttribute na;
-	for (na = 0; na < source_->getNoNumAtts(); na++) {
-		setCatVal(inst, ca, discretise(sourceInst_.getNumVal(na), na));
-		ca++;
-	}
-
-	return true;
-}
-
-bool InstanceStreamDiscretiser::advanceNumeric(instance &inst) {
-
-	inst.init(*source_);
-	if (!source_->advance(sourceInst_))
-		return false;
-
-	setClass(inst, sourceInst_.getClass());
-
-	CategoricalAttribute ca;
-
-	for (ca = 0; ca < source_->getNoCatAtts(); ca++) {
-		setCatVal(inst, ca, sourceInst_.getCatVal(ca));
-	}
-
-	for (NumericAttribute na = 0; na < source_->getNoNumAtts(); na++) {
-		setNumVal(inst, na, sourceInst_.getNumVal(na));
-	}
-
-	return true;
-}
-
-/// true if we have advanced past the last instance
-bool InstanceStreamDiscretiser::isAtEnd() {
-	return source_->isAtEnd();
-}
-
-/// the number of instances in the stream. This may require a pass through the stream to determine so should be used only if absolutely necessary.
-InstanceCount InstanceStreamDiscretiser::size() {
-	return source_->size();
-}
-
-void InstanceStreamDiscretiser::MetaData::setSource(
-		InstanceStream::MetaData* source) {
-	source_ = source;
-	noOfSourceCatAtts_ = source->getNoCatAtts();
-}
-
-/// return the number of categorical attributes
-unsigned int InstanceStreamDiscretiser::MetaData::getNoCatAtts() const {
-	return source_->getNoCatAtts() + cuts.size();
-}
-
-/// return the number of values for a categorical attribute
-unsigned int InstanceStreamDiscretiser::MetaData::getNoValues(
-		CategoricalAttribute att) const {
-	if (att < source_->getNoCatAtts())
-		return source_->getNoValues(att);
-	else {
-		return cuts[att - source_->getNoCatAtts()].size() + 1
-				+ source_->hasNumMissing(att - source_->getNoCatAtts());
-	}
-}
-
-/// return the name for a categorical Attribute
-const char* InstanceStreamDiscretiser::MetaData::getCatAttName(
-		CategoricalAttribute att) const {
-	if (att < source_->getNoCatAtts())
-		return source_->getCatAttName(att);
-	else
-		return source_->getNumAttName(att - source_->getNoCatAtts());
-}
-
-/// return the name for a categorical attribute value
-const char* InstanceStreamDiscretiser::MetaData::getCatAttValName(
-		CategoricalAttribute att, CatValue val) const {
-	if (att < source_->getNoCatAtts())
-		return source_->getCatAttValName(att, val);
-	else
-		return discAttValNames_[att - source_->getNoCatAtts()][val];
-}
-
-/// return the number of numeric attributes
-unsigned int InstanceStreamDiscretiser::MetaData::getNoNumAtts() const {
-	return 0;
-}
-
-unsigned int InstanceStreamDiscretiser::MetaData::getNoOrigCatAtts() const {
-	return noOfSourceCatAtts_;
-}
-
-/// return the name for a numeric attribute
-const char* InstanceStreamDiscretiser::MetaData::getNumAttName(
-		CategoricalAttribute) const {
-	assert(false);
-	return NULL;
-}
-
-/// return the name for a numeric attribute
-unsigned int InstanceStreamDiscretiser::MetaData::getPrecision(
-		NumericAttribute) const {
-	assert(false);
-	return 0;
-}
-
-/// return a string that gives a meaningful name for the stream
-const char* InstanceStreamDiscretiser::MetaData::getName() {
-	return "Discretised instance stream";
-}
-
-int InstanceStreamDiscretiser::MetaData::hasCatMissing(
-		CategoricalAttribute att) const {
-	return source_->hasCatMissing(att);
-}
-
-int InstanceStreamDiscretiser::MetaData::hasNumMissing(
-		NumericAttribute att) const {
-	return source_->hasNumMissing(att);
-}
-
-void InstanceStreamDiscretiser::MetaData::setAllAttsMissing() {
-	source_->setAllAttsMissing();
-}
+#include "instanceStreamDiscretiser.h"
+#include "globals.h"
+#include "mtrand.h"
+#include "utils.h"
+
+// discretisers
+#include "eqDepthDiscretiser.h"
+#include "MDLDiscretiser.h"
+#include "quantileDiscretiser.h"
+
+InstanceStreamDiscretiser::InstanceStreamDiscretiser(const char* name,
+		char* const *& argv, char* const * end) {
+	targetSampleSize_ = 100000;
+	sampleOffsets_ = false;
+	fused_ = false;
+
+	if (streq(name, "equal-depth") || streq(name, "equal-frequency")) {
+		theDiscretiser = new eqDepthDiscretiser(argv, end);
+	} else if (streq(name, "mdl")) {
+		theDiscretiser = new MDLDiscretiser(argv, end);
+	} else if (streq(name, "quantile")) {
+		theDiscretiser = new quantileDiscretiser(argv, end);
+	}else {
+		error("Discretiser %s not supported", name);
+	}
+	printMetaData_ = false;
+	allNumWithMiss_ = false;
+	// get arguments
+	while (argv != end) {
+		if (**argv == '-' && argv[0][1] == 's') {
+			getUIntFromStr(argv[0] + 2, targetSampleSize_, "s");
+			++argv;
+		} else if (**argv == '-' && argv[0][1] == 'R') {
+			sampleOffsets_ = true;
+			++argv;
+		} else if (**argv == '-' && argv[0][1] == 'M') {
+			allNumWithMiss_ = true;
+			++argv;
+		} else if (**argv == '-' && argv[0][1] == 'P') {
+			printMetaData_ = true;
+			++argv;
+		} else if (argv[0][1] == 'o') {
+			filename_ = &argv[0][2];
+			++argv;
+		} else {
+			break;  // do not consume the remaining arguments
+		}
+	}
+
+	if (printMetaData_ == true && filename_ == NULL) {
+		error("The meta file for output must be specified by -o.\n");
+	}
+
+	if (theDiscretiser == NULL) {
+		theDiscretiser = new eqDepthDiscretiser(argv, end);
+	}
+
+}
+
+InstanceStreamDiscretiser::~InstanceStreamDiscretiser(void) {
+	delete theDiscretiser;
+}
+
+// store an instance at position index of the sample
+static void storeInSample(const instance &inst, const unsigned long index, const unsigned int noNumAtts,
+		std::vector<std::vector<NumValue> > &vals, std::vector<std::vector<NumericAttribute> > &sampleAtts,
+		std::vector<CatValue> &classes) {
+	classes[index] = inst.getClass();
+	if (inst.isSparse()) {
+		// the sample starts as zeros, so only the attributes of the instance replaced and of the new instance change
+		if (sampleAtts.size() <= index) sampleAtts.resize(index + 1);
+		std::vector<NumericAttribute> &atts = sampleAtts[index];
+		for (unsigned int i = 0; i < atts.size(); i++) {
+			vals[atts[i]][index] = 0;
+		}
+		atts.clear();
+		for (unsigned int i = 0; i < inst.getNoNonZero(); i++) {
+			vals[inst.getNonZeroAtt(i)][index] = inst.getNonZeroVal(i);
+			atts.push_back(inst.getNonZeroAtt(i));
+		}
+	}
+	else {
+		for (NumericAttribute a = 0; a < noNumAtts; a++) {
+			vals[a][index] = inst.getNumVal(a);
+		}
+	}
+}
+
+/// find the cuts for an attribute from its values in the sample, or from those the discretiser has taken if it is streamed
+void InstanceStreamDiscretiser::findCuts(const NumericAttribute att, std::vector<NumValue> &vals, const std::vector<CatValue> &classes, const InstanceCount count) {
+	if (vals.size() > count) {
+		// if fewer values than stored, truncate
+		vals.resize(count);
+	}
+	metaData_.cuts[att].clear();
+	if (theDiscretiser->isStreamed())
+		theDiscretiser->streamedCuts(att, metaData_.cuts[att]);
+	else
+		theDiscretiser->discretise(vals, classes, source_->getNoClasses(), metaData_.cuts[att]);
+}
+
+// each worker discretises every noWorkers'th attribute, so the cuts do not depend on the timing of the threads
+void InstanceStreamDiscretiser::CutFinder::run(const unsigned int worker) {
+	for (NumericAttribute a = worker; a < vals_.size(); a += noWorkers_) {
+		discretiser_.findCuts(a, vals_[a], classes_, count_);
+	}
+}
+
+/// set the source for the filter
+void InstanceStreamDiscretiser::setSource(InstanceStream &src) {
+	std::vector<std::vector<NumValue> > vals;
+	std::vector<std::vector<NumericAttribute> > sampleAtts;  // for a sparse source, the attributes set in each sampled instance
+	std::vector<CatValue> classes;
+	InstanceCount count;
+	MTRand_int32 rand;
+
+	source_ = &src;
+	metaData_.setSource(src.getMetaData());
+
+	if (allNumWithMiss_)
+		metaData_.setAllAttsMissing();
+	InstanceStream::metaData_ = &metaData_;
+
+	sourceInst_.init(src);
+	count = 0;
+
+	if (theDiscretiser->isStreamed()) {
+		// the discretiser takes every value in a single pass, so no sample is kept
+		std::vector<InstanceCount> nonZero(src.getNoNumAtts(), 0);  // for a sparse source, the number of values of each attribute that are not 0
+		bool sparse = false;
+
+		theDiscretiser->startStream(src.getNoNumAtts());
+		vals.resize(src.getNoNumAtts());
+
+		src.rewind();
+
+		instance inst(src);
+
+		while (src.advance(inst)) {
+			count++;
+			if (inst.isSparse()) {
+				sparse = true;
+				for (unsigned int i = 0; i < inst.getNoNonZero(); i++) {
+					theDiscretiser->addValue(inst.getNonZeroAtt(i), inst.getNonZeroVal(i), 1);
+					nonZero[inst.getNonZeroAtt(i)]++;
+				}
+			}
+			else {
+				for (NumericAttribute a = 0; a < src.getNoNumAtts(); a++) {
+					theDiscretiser->addValue(a, inst.getNumVal(a), 1);
+				}
+			}
+		}
+
+		if (sparse) {
+			// the values of a sparse source that are not given are 0
+			for (NumericAttribute a = 0; a < src.getNoNumAtts(); a++) {
+				theDiscretiser->addValue(a, 0, count - nonZero[a]);
+			}
+		}
+	}
+	else {
+		// get the sample
+		vals.resize(src.getNoNumAtts());
+		for (NumericAttribute a = 0; a < src.getNoNumAtts(); a++) {
+			vals[a].resize(targetSampleSize_);
+		}
+		classes.resize(targetSampleSize_);
+
+		std::vector<instance> sampled;
+
+		if (src.sample(targetSampleSize_, sampleOffsets_, sampled)) {
+			// the source provides the sample without a pass
+			for (unsigned long i = 0; i < sampled.size(); i++) {
+				storeInSample(sampled[i], i, src.getNoNumAtts(), vals, sampleAtts, classes);
+			}
+			count = sampled.size();
+		}
+		else {
+			src.rewind();
+
+			instance inst(src);
+
+			while (src.advance(inst)) {
+				count++;  // keep track of the number of values seen
+				unsigned long index;
+
+				if (count <= targetSampleSize_) {
+					// if we have not yet got targetSampleSize_ examples, add this value to the end
+					index = count - 1;
+				} else {
+					// otherwise randomly determine whether to insert the value and where
+					index = rand(count);
+				}
+
+				if (index < targetSampleSize_) {
+					storeInSample(inst, index, src.getNoNumAtts(), vals, sampleAtts, classes);
+				}
+			}
+		}
+	}
+
+	metaData_.cuts.resize(src.getNoNumAtts());
+	metaData_.discAttValNames_.resize(src.getNoNumAtts());
+
+	if (classes.size() > count)
+		classes.resize(count);
+
+	// the attributes are discretised in parallel unless the discretiser reports its progress, which must be in attribute order
+	const bool parallel = noThreads > 1 && verbosity < 2 && src.getNoNumAtts() > 1;
+
+	if (parallel) {
+		WorkerPool pool(noThreads);
+		CutFinder finder(*this, vals, classes, count, pool.size());
+
+		pool.run(finder);
+	}
+
+	char buf[200];
+
+	FILE * output;
+	if (printMetaData_) {
+		output = fopen(filename_, "w");
+	}
+
+	if (printMetaData_) {
+
+		for (CategoricalAttribute ca = 0; ca < src.getNoCatAtts(); ca++) {
+			fprintf(output, "%s: ", src.getCatAttName(ca));
+			if (verbosity >= 2)
+				printf("%s: ", src.getCatAttName(ca));
+
+			for (unsigned int i = 0; i < src.getNoValues(ca); i++) {
+
+				if (i !=  (src.getNoValues(ca)-1))
+					sprintf(buf, "%u, ", i);
+				else
+					sprintf(buf, "%u", i);
+
+				fprintf(output, "%s", buf);
+				if (verbosity >= 2) {
+					printf("%s", buf);
+				}
+			}
+
+		        fprintf(output, "\n");
+			if (verbosity >= 2)
+			  putchar('\n');
+
+		}
+
+
+
+		for (NumericAttribute na = 0; na < src.getNoNumAtts(); na++) {
+			// discretise then set up the value names
+			if (!parallel)
+				findCuts(na, vals[na], classes, count);
+
+			fprintf(output, "%s: ", src.getNumAttName(na));
+			if (verbosity >= 2)
+				printf("%s: ", src.getNumAttName(na));
+
+                        unsigned int i;
+			// loop through all of the intervals that have been formed (note, one more interval than cut)
+			for (i = 0; i <= metaData_.cuts[na].size(); i++) {
+
+				//sprintf(buf, "%u", i);
+				if (i != metaData_.cuts[na].size())
+					sprintf(buf, "%u, ", i);
+				else
+					sprintf(buf, "%u", i);
+
+				fprintf(output, "%s", buf);
+				if (verbosity >= 2) {
+					printf("%s", buf);
+				}
+			}
+
+			// add missing value
+			if (metaData_.hasNumMissing(na)) {
+                                sprintf(buf, ", %u ", i++);
+				fprintf(output, "%s\n", buf);
+				if (verbosity >= 2)
+					printf("%s\n", buf);
+
+			} else {
+				fprintf(output, "\n");
+				if (verbosity >= 2)
+					putchar('\n');
+			}
+
+		}
+
+
+
+		fprintf(output, "class: ");
+		const char *sep = "";
+		for (CatValue i = 0; i < src.getNoClasses(); i++) {
+			fprintf(output, "%s%u", sep, i);
+			sep = ", ";
+		}
+		fprintf(output, "\n");
+
+	}
+
+	else {
+
+		for (NumericAttribute na = 0; na < src.getNoNumAtts(); na++) {
+			// discretise then set up the value names
+			if (!parallel)
+				findCuts(na, vals[na], classes, count);
+			if (verbosity >= 3)
+				printf("Discretisation for %s: ", src.getNumAttName(na));
+			// loop through all of the intervals that have been formed (note, one more interval than cut)
+			for (unsigned int i = 0; i <= metaData_.cuts[na].size(); i++) {
+				if (i == 0) {
+					if (metaData_.cuts[na].size() == 0) {
+						sprintf(buf, "known");
+					} else {
+						// print values to precision+1 in case cut points are placed between actual values
+						sprintf(buf, "<=%.*f", src.getPrecision(na) + 1,
+								metaData_.cuts[na][i]);
+					}
+				} else if (i < metaData_.cuts[na].size()) {
+					// print values to precision+1 in case cut points are placed between actual values
+					sprintf(buf, "(%.*f,%.*f]", src.getPrecision(na) + 1,
+							metaData_.cuts[na][i - 1], src.getPrecision(na) + 1,
+							metaData_.cuts[na][i]);
+				} else {
+					// print values to precision+1 in case cut points are placed between actual values
+					sprintf(buf, ">%.*f", src.getPrecision(na) + 1,
+							metaData_.cuts[na][i - 1]);
+				}
+				if (verbosity >= 3) {
+					printf("%s ", buf);
+					if (i != metaData_.cuts[na].size())
+						printf(", ");
+				}
+				char *newbuf;
+				safeAlloc(newbuf, strlen(buf) + 1);
+				strcpy(newbuf, buf);
+				metaData_.discAttValNames_[na].push_back(newbuf);
+
+			}
+			// add missing value
+			if (metaData_.hasNumMissing(na)) {
+				const char *mstr;
+				mstr = ", unknown";
+				char *newbuf;
+				if (verbosity >= 3)
+					printf("%s\n", mstr);
+				safeAlloc(newbuf, strlen(mstr) + 1);
+				strcpy(newbuf, mstr);
+				metaData_.discAttValNames_[na].push_back(newbuf);
+			} else {
+				if (verbosity >= 3)
+					putchar('\n');
+			}
+		}
+
+	}
+
+	if (printMetaData_) {
+		fclose(output);
+	}
+
+	// the discretised value of 0, which is held by every attribute not present in a sparse instance
+	zeroVal_.resize(src.getNoNumAtts());
+	for (NumericAttribute na = 0; na < src.getNoNumAtts(); na++) {
+		zeroVal_[na] = discretise(0, na);
+	}
+
+	// once the cuts are known the source may be able to discretise its numeric values as it reads them
+	fused_ = src.canAdvanceDiscretised();
+
+	rewind();
+}
+
+InstanceStream *InstanceStreamDiscretiser::getTransformSource() {
+	return source_;
+}
+
+/// each numeric attribute becomes a categorical attribute following the existing ones, discretised by its cuts
+void InstanceStreamDiscretiser::composeTransform(Transform &t) const {
+	if (t.numFrom.empty()) return;
+
+	t.allCuts = t.keepsAtts() ? &metaData_.cuts : NULL;
+
+	for (NumericAttribute na = 0; na < t.numFrom.size(); na++) {
+		t.catFrom.push_back(Transform::CatSource(t.numFrom[na], &metaData_.cuts[na]));
+	}
+
+	t.numFrom.clear();
+}
+
+/// the categorical attributes following those of the source are read from the numeric attributes of the source
+void InstanceStreamDiscretiser::setProjection(const std::vector<bool> &catAtts, const std::vector<bool> &) {
+	if (catAtts.empty()) {
+		source_->setProjection(catAtts, catAtts);
+		return;
+	}
+
+	const unsigned int noSourceCatAtts = source_->getNoCatAtts();
+	const std::vector<bool> sourceCatAtts(catAtts.begin(), catAtts.begin() + noSourceCatAtts);
+	const std::vector<bool> sourceNumAtts(catAtts.begin() + noSourceCatAtts, catAtts.end());
+
+	source_->setProjection(sourceCatAtts, sourceNumAtts);
+}
+
+/// return to the first instance in the stream
+void InstanceStreamDiscretiser::rewind() {
+	source_->rewind();
+}
+
+/// advance, discarding the next instance in the stream.  Return true iff successful.
+bool InstanceStreamDiscretiser::advance() {
+	return source_->advance();
+}
+
+CatValue InstanceStreamDiscretiser::discretise(const NumValue val,
+		const NumericAttribute na) const {
+	return discretiseValue(val, metaData_.cuts[na]);
+}
+
+void InstanceStreamDiscretiser::discretiseInstance(const instance &inst,
+		instance &instDisc) {
+	CategoricalAttribute ca;
+
+	setDense(instDisc);
+
+	for (ca = 0; ca < source_->getNoCatAtts(); ca++) {
+		setCatVal(instDisc, ca, inst.getCatVal(ca));
+	}
+
+	for (NumericAttribute na = 0; na < source_->getNoNumAtts(); na++) {
+		setCatVal(instDisc, ca, discretise(inst.getNumVal(na), na));
+		ca++;
+	}
+	instDisc.setClass(inst.getClass());
+}
+
+/// advance to the next instance in the stream. Return true iff successful. @param inst the instance record to receive the new instance. 
+bool InstanceStreamDiscretiser::advance(instance &inst) {
+
+	if (fused_) {
+		return source_->advanceDiscretised(inst, metaData_.cuts);
+	}
+
+	if (!source_->advance(sourceInst_))
+		return false;
+
+	setClass(inst, sourceInst_.getClass());
+
+	CategoricalAttribute ca;
+
+	for (ca = 0; ca < source_->getNoCatAtts(); ca++) {
+		setCatVal(inst, ca, sourceInst_.getCatVal(ca));
+	}
+
+	if (sourceInst_.isSparse()) {
+		advanceSparse(inst);
+		return true;
+	}
+
+	setDense(inst);
+
+	NumericAttribute na;
+	for (na = 0; na < source_->getNoNumAtts(); na++) {
+		setCatVal(inst, ca, discretise(sourceInst_.getNumVal(na), na));
+		ca++;
+	}
+
+	return true;
+}
+
+/// discretise the numeric attributes of a sparse source instance.  Only the attributes in its pairs, and those in the pairs of the
+/// previous instance written to inst, are set, so the work is proportional to the number of non-zero values rather than the width
+void InstanceStreamDiscretiser::advanceSparse(instance &inst) {
+	const CategoricalAttribute firstNum = source_->getNoCatAtts();
+
+	if (inst.sparseLayout == this) {
+		for (unsigned int i = 0; i < inst.nonZeroAtts.size(); i++) {
+			const NumericAttribute na = inst.nonZeroAtts[i];
+			setCatVal(inst, firstNum + na, zeroVal_[na]);
+		}
+	}
+	else {
+		for (NumericAttribute na = 0; na < source_->getNoNumAtts(); na++) {
+			setCatVal(inst, firstNum + na, zeroVal_[na]);
+		}
+		inst.sparseLayout = this;
+	}
+
+	inst.nonZeroAtts = sourceInst_.nonZeroAtts;
+	inst.nonZeroVals = sourceInst_.nonZeroVals;
+
+	for (unsigned int i = 0; i < inst.nonZeroAtts.size(); i++) {
+		const NumericAttribute na = inst.nonZeroAtts[i];
+		setCatVal(inst, firstNum + na, discretise(inst.nonZeroVals[i], na));
+	}
+}
+
+bool InstanceStreamDiscretiser::advanceNumeric(instance &inst) {
+
+	inst.init(*source_);
+	if (!source_->advance(sourceInst_))
+		return false;
+
+	setClass(inst, sourceInst_.getClass());
+
+	CategoricalAttribute ca;
+
+	for (ca = 0; ca < source_->getNoCatAtts(); ca++) {
+		setCatVal(inst, ca, sourceInst_.getCatVal(ca));
+	}
+
+	setDense(inst);
+
+	for (NumericAttribute na = 0; na < source_->getNoNumAtts(); na++) {
+		setNumVal(inst, na, sourceInst_.getNumVal(na));
+	}
+
+	return true;
+}
+
+/// true if we have advanced past the last instance
+bool InstanceStreamDiscretiser::isAtEnd() {
+	return source_->isAtEnd();
+}
+
+/// the number of instances in the stream. This may require a pass through the stream to determine so should be used only if absolutely necessary.
+InstanceCount InstanceStreamDiscretiser::size() {
+	return source_->size();
+}
+
+void InstanceStreamDiscretiser::MetaData::setSource(
+		InstanceStream::MetaData* source) {
+	source_ = source;
+	noOfSourceCatAtts_ = source->getNoCatAtts();
+}
+
+/// return the number of categorical attributes
+unsigned int InstanceStreamDiscretiser::MetaData::getNoCatAtts() const {
+	return source_->getNoCatAtts() + cuts.size();
+}
+
+/// return the number of values for a categorical attribute
+unsigned int InstanceStreamDiscretiser::MetaData::getNoValues(
+		CategoricalAttribute att) const {
+	if (att < source_->getNoCatAtts())
+		return source_->getNoValues(att);
+	else {
+		return cuts[att - source_->getNoCatAtts()].size() + 1
+				+ source_->hasNumMissing(att - source_->getNoCatAtts());
+	}
+}
+
+/// return the name for a categorical Attribute
+const char* InstanceStreamDiscretiser::MetaData::getCatAttName(
+		CategoricalAttribute att) const {
+	if (att < source_->getNoCatAtts())
+		return source_->getCatAttName(att);
+	else
+		return source_->getNumAttName(att - source_->getNoCatAtts());
+}
+
+/// return the name for a categorical attribute value
+const char* InstanceStreamDiscretiser::MetaData::getCatAttValName(
+		CategoricalAttribute att, CatValue val) const {
+	if (att < source_->getNoCatAtts())
+		return source_->getCatAttValName(att, val);
+	else
+		return discAttValNames_[att - source_->getNoCatAtts()][val];
+}
+
+/// return the number of numeric attributes
+unsigned int InstanceStreamDiscretiser::MetaData::getNoNumAtts() const {
+	return 0;
+}
+
+unsigned int InstanceStreamDiscretiser::MetaData::getNoOrigCatAtts() const {
+	return noOfSourceCatAtts_;
+}
+
+/// return the name for a numeric attribute
+const char* InstanceStreamDiscretiser::MetaData::getNumAttName(
+		CategoricalAttribute) const {
+	assert(false);
+	return NULL;
+}
+
+/// return the name for a numeric attribute
+unsigned int InstanceStreamDiscretiser::MetaData::getPrecision(
+		NumericAttribute) const {
+	assert(false);
+	return 0;
+}
+
+/// return a string that gives a meaningful name for the stream
+const char* InstanceStreamDiscretiser::MetaData::getName() {
+	return "Discretised instance stream";
+}
+
+int InstanceStreamDiscretiser::MetaData::hasCatMissing(
+		CategoricalAttribute att) const {
+	return source_->hasCatMissing(att);
+}
+
+int InstanceStreamDiscretiser::MetaData::hasNumMissing(
+		NumericAttribute att) const {
+	return source_->hasNumMissing(att);
+}
+
+void InstanceStreamDiscretiser::MetaData::setAllAttsMissing() {
+	source_->setAllAttsMissing();
+}
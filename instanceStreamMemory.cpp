@@ -0,0 +1,395 @@
+/* Open source system for classification learning from very large data
+** Class for a stream that holds the instances of another stream in memory
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "instanceStreamMemory.h"
+#include "instanceBatch.h"
+#include "globals.h"
+#include "utils.h"
+
+#include <limits>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// the number of bits needed to store the values 0..noValues-1
+static unsigned int bitsFor(const unsigned int noValues) {
+  unsigned int bits = 0;
+
+  while (bits < 32 && (1ULL << bits) < noValues) bits++;
+
+  return bits;
+}
+
+// release the unused capacity of a vector
+template <typename T>
+static void shrink(std::vector<T> &v) {
+  std::vector<T>(v).swap(v);
+}
+
+InstanceStreamMemory::InstanceStreamMemory(InstanceStream *src, const char *dataFileName)
+  : recordBits_(0), indexed_(false)
+{ setSource(*src);
+
+  width_.resize(getNoCatAtts() + 1);
+  offset_.resize(getNoCatAtts() + 1);
+
+  for (CategoricalAttribute a = 0; a <= getNoCatAtts(); a++) {
+    width_[a] = bitsFor(a < getNoCatAtts() ? getNoValues(a) : getNoClasses());
+    offset_[a] = recordBits_;
+    recordBits_ += width_[a];
+  }
+
+  loadInst_.init(*this);
+
+  reload(dataFileName);
+}
+
+InstanceStreamMemory::~InstanceStreamMemory(void)
+{
+}
+
+void InstanceStreamMemory::reload(const char *dataFileName) {
+  if (dataFileName == NULL) dataFileName_.clear();
+  else dataFileName_.assign(dataFileName, dataFileName + strlen(dataFileName) + 1);
+  clear();
+}
+
+void InstanceStreamMemory::hold(const instance &inst) {
+  assert(!loaded_);
+  store(inst);
+}
+
+void InstanceStreamMemory::finishHold() {
+  finishLoad();
+}
+
+size_t InstanceStreamMemory::getBytes() const {
+  return bits_.size() * sizeof(unsigned long long) + numVals_.size() * sizeof(NumValue)
+       + pairStart_.size() * sizeof(unsigned long long) + pairAtts_.size() * sizeof(NumericAttribute)
+       + pairVals_.size() * sizeof(NumValue);
+}
+
+void InstanceStreamMemory::clear() {
+  bits_.clear();
+  numVals_.clear();
+  pairStart_.assign(1, 0);
+  pairAtts_.clear();
+  pairVals_.clear();
+  sparse_ = false;
+  loaded_ = false;
+  index_.clear();
+  count_ = 0;
+  next_ = 0;
+}
+
+/// return to the first instance in the stream.  If the source is not yet held, the pass loads it from the start.
+void InstanceStreamMemory::rewind() {
+  if (loaded_) {
+    next_ = 0;
+  }
+  else {
+    clear();
+    source_->rewind();
+  }
+}
+
+void InstanceStreamMemory::store(const instance &inst) {
+  const unsigned long long start = static_cast<unsigned long long>(count_) * recordBits_;
+
+  bits_.resize(static_cast<size_t>((start + recordBits_ + 63) / 64), 0);
+
+  for (CategoricalAttribute a = 0; a <= getNoCatAtts(); a++) {
+    const unsigned long long v = a < getNoCatAtts() ? inst.getCatVal(a) : inst.getClass();
+    const unsigned long long bit = start + offset_[a];
+    const size_t w = static_cast<size_t>(bit >> 6);
+    const unsigned int shift = static_cast<unsigned int>(bit & 63);
+
+    assert(v < (1ULL << width_[a]) || (v == 0 && width_[a] == 0));
+
+    if (width_[a] == 0) continue;
+
+    bits_[w] |= v << shift;
+    if (shift + width_[a] > 64) bits_[w + 1] |= v >> (64 - shift);
+  }
+
+  if (count_ == 0) sparse_ = inst.isSparse();
+
+  if (sparse_) {
+    for (unsigned int i = 0; i < inst.getNoNonZero(); i++) {
+      pairAtts_.push_back(inst.getNonZeroAtt(i));
+      pairVals_.push_back(inst.getNonZeroVal(i));
+    }
+    pairStart_.push_back(pairAtts_.size());
+  }
+  else {
+    for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+      numVals_.push_back(inst.getNumVal(a));
+    }
+  }
+
+  if (count_ == std::numeric_limits<InstanceCount>::max()) {
+    error("Instance count exceeds system limit of %" ICFMT, std::numeric_limits<InstanceCount>::max());
+  }
+  count_++;
+}
+
+void InstanceStreamMemory::finishLoad() {
+  loaded_ = true;
+  next_ = count_;
+
+  shrink(bits_);
+  shrink(numVals_);
+  shrink(pairStart_);
+  shrink(pairAtts_);
+  shrink(pairVals_);
+
+  if (verbosity >= 1 && !dataFileName_.empty()) {
+    const double bytes = getBytes();
+    struct stat buf;
+
+    printf("Holding %" ICFMT " instances in memory in %.1f MB (%u bits per instance", count_, bytes / (1 << 20), recordBits_);
+    if (sparse_) printf(" plus its non-zero values)");
+    else printf(" plus %u numeric values)", getNoNumAtts());
+    if (stat(&dataFileName_[0], &buf) == 0 && buf.st_size > 0) {
+      printf(", %.1f%% of the %.1f MB data file", 100.0 * bytes / buf.st_size, static_cast<double>(buf.st_size) / (1 << 20));
+    }
+    printf("\n");
+  }
+}
+
+void InstanceStreamMemory::replay(instance &inst) {
+  const unsigned long long start = static_cast<unsigned long long>(next_) * recordBits_;
+
+  for (CategoricalAttribute a = 0; a < getNoCatAtts(); a++) {
+    setCatVal(inst, a, getBits(start + offset_[a], width_[a]));
+  }
+
+  setClass(inst, getBits(start + offset_[getNoCatAtts()], width_[getNoCatAtts()]));
+}
+
+/// advance, discarding the next instance in the stream.  Return true iff successful.
+bool InstanceStreamMemory::advance() {
+  if (!loaded_) return advance(loadInst_);
+
+  if (next_ >= count_) return false;
+
+  next_++;
+
+  return true;
+}
+
+/// advance to the next instance in the stream.  Return true iff successful. @param inst the instance record to receive the new instance.
+bool InstanceStreamMemory::advance(instance &inst) {
+  if (!loaded_) {
+    if (!source_->advance(inst)) {
+      finishLoad();
+      return false;
+    }
+
+    store(inst);
+
+    return true;
+  }
+
+  if (next_ >= count_) return false;
+
+  replay(inst);
+
+  if (sparse_) {
+    startSparse(inst);
+    for (unsigned long long i = pairStart_[next_]; i < pairStart_[next_ + 1]; i++) {
+      setSparseNumVal(inst, pairAtts_[i], pairVals_[i]);
+    }
+  }
+  else {
+    setDense(inst);
+
+    const size_t start = static_cast<size_t>(next_) * getNoNumAtts();
+
+    for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+      setNumVal(inst, a, numVals_[start + a]);
+    }
+  }
+
+  next_++;
+
+  return true;
+}
+
+template <typename T>
+void InstanceStreamMemory::fillCatCols(InstanceBatch &batch, const unsigned long long start, const unsigned int size) const {
+  for (CategoricalAttribute a = 0; a < getNoCatAtts(); a++) {
+    T *col = batch.catCol<T>(a);
+
+    for (unsigned int i = 0; i < size; i++) {
+      col[i] = static_cast<T>(getBits(start + static_cast<unsigned long long>(i) * recordBits_ + offset_[a], width_[a]));
+    }
+  }
+}
+
+/// advance over up to n instances, storing them in the batch.  Once the source is held the batch is filled a column at a time.
+unsigned int InstanceStreamMemory::advance(InstanceBatch &batch, const unsigned int n) {
+  if (!loaded_) return InstanceStream::advance(batch, n);
+
+  assert(n <= batch.capacity());
+
+  const unsigned int size = count_ - next_ < n ? count_ - next_ : n;
+  const unsigned int capacity = batch.capacity();
+
+  batch.size_ = size;
+
+  if (size == 0) return 0;
+
+  const unsigned long long start = static_cast<unsigned long long>(next_) * recordBits_;
+
+  switch (batch.getCatWidth()) {
+  case 1: fillCatCols<unsigned char>(batch, start, size); break;
+  case 2: fillCatCols<unsigned short>(batch, start, size); break;
+  default: fillCatCols<CatValue>(batch, start, size); break;
+  }
+
+  for (unsigned int i = 0; i < size; i++) {
+    batch.classes_[i] = getBits(start + static_cast<unsigned long long>(i) * recordBits_ + offset_[getNoCatAtts()], width_[getNoCatAtts()]);
+  }
+
+  if (sparse_) {
+    for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+      std::fill(&batch.numVals_[a * capacity], &batch.numVals_[a * capacity] + size, 0.0f);
+    }
+
+    for (unsigned int i = 0; i < size; i++) {
+      for (unsigned long long p = pairStart_[next_ + i]; p < pairStart_[next_ + i + 1]; p++) {
+        batch.numVals_[pairAtts_[p] * capacity + i] = pairVals_[p];
+      }
+    }
+  }
+  else {
+    for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+      NumValue *col = &batch.numVals_[a * capacity];
+      const NumValue *vals = &numVals_[static_cast<size_t>(next_) * getNoNumAtts() + a];
+
+      for (unsigned int i = 0; i < size; i++) {
+        col[i] = vals[static_cast<size_t>(i) * getNoNumAtts()];
+      }
+    }
+  }
+
+  next_ += size;
+
+  return size;
+}
+
+bool InstanceStreamMemory::canAdvanceDiscretised() {
+  return !sparse_;
+}
+
+/// advance to the next instance in the stream, discretising its numeric values.  Return true iff successful.
+bool InstanceStreamMemory::advanceDiscretised(instance &inst, const Cuts &cuts) {
+  const CategoricalAttribute firstNum = getNoCatAtts();
+
+  setDense(inst);
+
+  if (!loaded_ || sparse_) {
+    // take the whole instance, so that it is loaded or its sparse values are expanded
+    if (!advance(loadInst_)) return false;
+
+    for (CategoricalAttribute a = 0; a < firstNum; a++) {
+      setCatVal(inst, a, loadInst_.getCatVal(a));
+    }
+
+    setClass(inst, loadInst_.getClass());
+
+    for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+      setCatVal(inst, firstNum + a, discretiseValue(loadInst_.getNumVal(a), cuts[a]));
+    }
+
+    return true;
+  }
+
+  if (next_ >= count_) return false;
+
+  replay(inst);
+
+  const size_t start = static_cast<size_t>(next_) * getNoNumAtts();
+
+  for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+    setCatVal(inst, firstNum + a, discretiseValue(numVals_[start + a], cuts[a]));
+  }
+
+  next_++;
+
+  return true;
+}
+
+/// true if we have advanced past the last instance.  Reaching the end of the source completes the load.
+bool InstanceStreamMemory::isAtEnd() {
+  if (loaded_) return next_ >= count_;
+
+  if (source_->isAtEnd()) {
+    finishLoad();
+    return true;
+  }
+
+  return false;
+}
+
+/// the number of instances in the stream.  If the source is not yet held this loads it.
+InstanceCount InstanceStreamMemory::size() {
+  if (!loaded_) {
+    rewind();
+
+    while (advance()) {}
+  }
+
+  return count_;
+}
+
+/// the bitmap index of the instances held, if the stream keeps one.  The first request loads the source, if it is not yet held,
+/// and builds the index from the instances held.
+BitmapIndex *InstanceStreamMemory::getBitmapIndex() {
+  if (!indexed_) return NULL;
+
+  if (!index_.isBuilt()) {
+    size();
+    index_.build(*this);
+
+    if (verbosity >= 1 && !dataFileName_.empty()) {
+      printf("Indexing the %" ICFMT " instances held in %.1f MB of bitmaps\n", count_, static_cast<double>(index_.getBytes()) / (1 << 20));
+    }
+  }
+
+  return &index_;
+}
+
+void InstanceStreamMemory::setProjection(const std::vector<bool> &, const std::vector<bool> &) {
+}
+
+/// position the stream so that the next advance returns instance inst.  Return false iff the stream has fewer instances.
+bool InstanceStreamMemory::seek(const InstanceCount inst) {
+  if (!loaded_) return InstanceStream::seek(inst);
+
+  if (inst > count_) {
+    next_ = count_;
+    return false;
+  }
+
+  next_ = inst;
+
+  return true;
+}
@@ -0,0 +1,98 @@
+/* Open source system for classification learning from very large data
+** Class for a stream that holds the instances of another stream in memory
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "instanceStreamFilter.h"
+#include "bitmapIndex.h"
+
+#include <vector>
+
+/// The instances of a source stream, loaded into memory during the first pass and replayed from memory in later passes.
+/// Each instance is stored as a record of bits in which every categorical attribute and the class take
+/// ceil(log2(number of values)) bits.  Numeric values are stored as floats, and for a sparse source only the
+/// (attribute, value) pairs of each instance are stored.
+/// A pass that is abandoned before the end of the source discards what has been loaded, so the next pass loads it again.
+/// Alternatively a client may choose the instances to hold, passing each to hold() and then calling finishHold(),
+/// in which case the source provides only the metadata.
+/// If asked to, the stream also keeps a BitmapIndex of the instances held, from which a learner can count the pairs of attributes
+/// without a pass.
+class InstanceStreamMemory : public InstanceStreamFilter
+{
+public:
+  InstanceStreamMemory(InstanceStream *src, const char *dataFileName);
+  ~InstanceStreamMemory(void);
+
+  void rewind();                                              ///< return to the first instance in the stream
+  bool advance();                                             ///< advance, discarding the next instance in the stream.  Return true iff successful.
+  bool advance(instance &inst);                               ///< advance to the next instance in the stream.  Return true iff successful. @param inst the instance record to receive the new instance.
+  unsigned int advance(InstanceBatch &batch, const unsigned int n);  ///< advance over up to n instances, storing them in the batch.  Return the number stored.
+  bool canAdvanceDiscretised();                               ///< true unless the source is sparse, whose instances are discretised more quickly from their pairs
+  bool advanceDiscretised(instance &inst, const Cuts &cuts);  ///< advance to the next instance in the stream, discretising its numeric values.  Return true iff successful.
+  bool isAtEnd();                                             ///< true if we have advanced past the last instance
+  InstanceCount size();                                       ///< the number of instances in the stream.  The stream state is undefined after a call to size(), so a rewind shouldbe performed before the next advance.
+  bool seek(const InstanceCount inst);                        ///< position the stream so that the next advance returns instance inst.  Return false iff the stream has fewer instances.
+  void setProjection(const std::vector<bool> &catAtts, const std::vector<bool> &numAtts);  ///< ignore the projection, as every attribute is held for later passes
+  BitmapIndex *getBitmapIndex();                              ///< the bitmap index of the instances held, if the stream keeps one, loading the source and building the index if they are not yet held
+
+  void reload(const char *dataFileName);                      ///< discard the instances held, so that the next pass loads them from the source, which now reads dataFileName.  If dataFileName is NULL the memory used is not reported.
+
+  void hold(const instance &inst);      ///< add an instance to those held, when the client chooses the instances
+  void finishHold();                    ///< record that the client has added all the instances to be held
+  inline bool isLoaded() const { return loaded_; }            ///< true iff all the instances to be held are held
+  inline void setIndexed(const bool indexed) { indexed_ = indexed; }  ///< keep a bitmap index of the instances held
+  size_t getBytes() const;              ///< the number of bytes used to hold the instances
+
+private:
+  void clear();                         ///< discard the instances held and prepare to load them
+  void store(const instance &inst);     ///< append an instance to those held
+  void finishLoad();                    ///< record that the whole of the source is held and report the memory used
+  void replay(instance &inst);          ///< write the categorical attributes and class of the next instance held to inst
+
+  template <typename T>
+  void fillCatCols(InstanceBatch &batch, const unsigned long long start, const unsigned int size) const;  ///< write the categorical attributes of size instances held, from bit start, to the columns of type T
+
+  /// the value of width bits starting at bit
+  inline CatValue getBits(const unsigned long long bit, const unsigned int width) const {
+    const size_t w = static_cast<size_t>(bit >> 6);
+    const unsigned int shift = static_cast<unsigned int>(bit & 63);
+    unsigned long long v = bits_[w] >> shift;
+    if (shift + width > 64) v |= bits_[w + 1] << (64 - shift);
+    return static_cast<CatValue>(v & ((1ULL << width) - 1));
+  }
+
+  std::vector<char> dataFileName_;      ///< the name of the file from which the source reads, for reporting the memory used
+  std::vector<unsigned int> width_;     ///< the number of bits used for each categorical attribute and, last, the class
+  std::vector<unsigned int> offset_;    ///< the offset within a record of each categorical attribute and, last, the class
+  unsigned int recordBits_;             ///< the number of bits in the record for an instance
+
+  std::vector<unsigned long long> bits_;  ///< the records of the instances held
+  std::vector<NumValue> numVals_;       ///< the numeric values of the instances held, unless the source is sparse
+  bool sparse_;                         ///< true iff the instances of the source are sparse
+  std::vector<unsigned long long> pairStart_;  ///< for a sparse source, the first pair of each instance, and the number of pairs held
+  std::vector<NumericAttribute> pairAtts_;     ///< for a sparse source, the attribute of each pair
+  std::vector<NumValue> pairVals_;      ///< for a sparse source, the value of each pair
+
+  bool loaded_;                         ///< true iff the whole of the source is held
+  bool indexed_;                        ///< true iff the stream keeps a bitmap index of the instances held
+  BitmapIndex index_;                   ///< the bitmap index of the instances held, built when first requested
+  InstanceCount count_;                 ///< the number of instances held
+  InstanceCount next_;                  ///< the next instance to replay
+  instance loadInst_;                   ///< receives the instances that are skipped while the source is loaded
+};
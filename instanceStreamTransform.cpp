@@ -0,0 +1,216 @@
+/* Open source system for classification learning from very large data
+** Class for a stream that applies a chain of filters to the instances of a base stream in one step
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "instanceStreamTransform.h"
+
+const CategoricalAttribute InstanceStreamTransform::NOATT;
+
+InstanceStreamTransform::InstanceStreamTransform() : baseDiscretises_(false)
+{
+}
+
+InstanceStreamTransform::~InstanceStreamTransform(void)
+{
+}
+
+void InstanceStreamTransform::setTransform(InstanceStream &base, InstanceStream &top, const Transform &t) {
+  source_ = &base;
+  metaData_ = top.getMetaData();
+  transform_ = t;
+
+  assert(transform_.catFrom.size() == getNoCatAtts());
+  assert(transform_.numFrom.size() == getNoNumAtts());
+
+  zeroVal_.assign(getNoCatAtts(), 0);
+  discretisedAs_.assign(base.getNoNumAtts(), NOATT);
+
+  for (CategoricalAttribute a = 0; a < getNoCatAtts(); a++) {
+    const Transform::CatSource &from = transform_.catFrom[a];
+
+    if (from.cuts != NULL) {
+      zeroVal_[a] = discretiseValue(0, *from.cuts);
+      discretisedAs_[from.att] = a;
+    }
+  }
+
+  // the base may be able to discretise its numeric values as it reads them
+  baseDiscretises_ = transform_.allCuts != NULL && base.canAdvanceDiscretised();
+
+  baseInst_.init(base);
+  baseBatch_.init(base);
+}
+
+/// each flagged attribute is mapped from a categorical or numeric attribute of the base, which must be read
+void InstanceStreamTransform::setProjection(const std::vector<bool> &catAtts, const std::vector<bool> &numAtts) {
+  if (catAtts.empty() && numAtts.empty()) {
+    source_->setProjection(catAtts, numAtts);
+    return;
+  }
+
+  std::vector<bool> baseCatAtts(source_->getNoCatAtts(), false);
+  std::vector<bool> baseNumAtts(source_->getNoNumAtts(), false);
+
+  for (CategoricalAttribute a = 0; a < getNoCatAtts(); a++) {
+    if (catAtts.empty() || catAtts[a]) {
+      const Transform::CatSource &from = transform_.catFrom[a];
+
+      if (from.cuts == NULL) baseCatAtts[from.att] = true;
+      else baseNumAtts[from.att] = true;
+    }
+  }
+
+  for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+    if (numAtts.empty() || numAtts[a]) baseNumAtts[transform_.numFrom[a]] = true;
+  }
+
+  source_->setProjection(baseCatAtts, baseNumAtts);
+}
+
+/// advance to the next instance in the stream. Return true iff successful. @param inst the instance record to receive the new instance.
+bool InstanceStreamTransform::advance(instance &inst) {
+  if (baseDiscretises_) {
+    if (!source_->advanceDiscretised(inst, *transform_.allCuts)) return false;
+
+    setClass(inst, transform_.classMap[inst.getClass()]);
+
+    return true;
+  }
+
+  if (!source_->advance(baseInst_)) return false;
+
+  setClass(inst, transform_.classMap[baseInst_.getClass()]);
+
+  for (CategoricalAttribute a = 0; a < getNoCatAtts(); a++) {
+    const Transform::CatSource &from = transform_.catFrom[a];
+
+    if (from.cuts == NULL) setCatVal(inst, a, baseInst_.getCatVal(from.att));
+  }
+
+  for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+    setNumVal(inst, a, baseInst_.getNumVal(transform_.numFrom[a]));
+  }
+
+  if (baseInst_.isSparse()) {
+    advanceSparse(inst);
+    return true;
+  }
+
+  setDense(inst);
+
+  for (CategoricalAttribute a = 0; a < getNoCatAtts(); a++) {
+    const Transform::CatSource &from = transform_.catFrom[a];
+
+    if (from.cuts != NULL) setCatVal(inst, a, discretiseValue(baseInst_.getNumVal(from.att), *from.cuts));
+  }
+
+  return true;
+}
+
+/// discretise the numeric attributes of a sparse base instance.  As for InstanceStreamDiscretiser, only the attributes
+/// in its pairs, and those in the pairs of the previous instance written to inst, are set, and inst takes the pairs of the base.
+void InstanceStreamTransform::advanceSparse(instance &inst) {
+  if (inst.sparseLayout == this) {
+    for (unsigned int i = 0; i < inst.nonZeroAtts.size(); i++) {
+      const CategoricalAttribute a = discretisedAs_[inst.nonZeroAtts[i]];
+      if (a != NOATT) setCatVal(inst, a, zeroVal_[a]);
+    }
+  }
+  else {
+    for (CategoricalAttribute a = 0; a < getNoCatAtts(); a++) {
+      if (transform_.catFrom[a].cuts != NULL) setCatVal(inst, a, zeroVal_[a]);
+    }
+    inst.sparseLayout = this;
+  }
+
+  inst.nonZeroAtts = baseInst_.nonZeroAtts;
+  inst.nonZeroVals = baseInst_.nonZeroVals;
+
+  for (unsigned int i = 0; i < inst.nonZeroAtts.size(); i++) {
+    const CategoricalAttribute a = discretisedAs_[inst.nonZeroAtts[i]];
+    if (a != NOATT) setCatVal(inst, a, discretiseValue(inst.nonZeroVals[i], *transform_.catFrom[a].cuts));
+  }
+}
+
+// copy a categorical column of the base batch, of type From, to a column of type To
+template <typename To, typename From>
+static void copyCol(To *to, const From *from, const unsigned int size) {
+  for (unsigned int i = 0; i < size; i++) {
+    to[i] = static_cast<To>(from[i]);
+  }
+}
+
+template <typename T>
+void InstanceStreamTransform::transformBatch(InstanceBatch &batch, const unsigned int start, const unsigned int size) {
+  const CatValue *baseClasses = baseBatch_.getClasses();
+
+  for (unsigned int i = 0; i < size; i++) {
+    batch.classes_[start + i] = transform_.classMap[baseClasses[i]];
+  }
+
+  for (CategoricalAttribute a = 0; a < getNoCatAtts(); a++) {
+    const Transform::CatSource &from = transform_.catFrom[a];
+    T *col = batch.catCol<T>(a) + start;
+
+    if (from.cuts != NULL) {
+      const NumValue *vals = baseBatch_.getNumCol(from.att);
+      const std::vector<NumValue> &cuts = *from.cuts;
+
+      for (unsigned int i = 0; i < size; i++) {
+        col[i] = static_cast<T>(discretiseValue(vals[i], cuts));
+      }
+    }
+    else {
+      switch (baseBatch_.getCatWidth()) {
+      case 1: copyCol(col, baseBatch_.getCatCol<unsigned char>(from.att), size); break;
+      case 2: copyCol(col, baseBatch_.getCatCol<unsigned short>(from.att), size); break;
+      default: copyCol(col, baseBatch_.getCatCol<CatValue>(from.att), size); break;
+      }
+    }
+  }
+
+  for (NumericAttribute a = 0; a < getNoNumAtts(); a++) {
+    std::copy(baseBatch_.getNumCol(transform_.numFrom[a]), baseBatch_.getNumCol(transform_.numFrom[a]) + size, &batch.numVals_[a * batch.capacity() + start]);
+  }
+}
+
+/// advance over up to n instances, storing them in the batch.  The instances are read from the base in batches
+/// and each attribute of the batch is mapped from the base in one loop.
+unsigned int InstanceStreamTransform::advance(InstanceBatch &batch, const unsigned int n) {
+  assert(n <= batch.capacity());
+
+  batch.size_ = 0;
+
+  while (batch.size_ < n) {
+    // the base batch holds the numeric values too, so it may hold fewer instances
+    const unsigned int wanted = n - batch.size_ < baseBatch_.capacity() ? n - batch.size_ : baseBatch_.capacity();
+    const unsigned int size = source_->advance(baseBatch_, wanted);
+
+    switch (batch.getCatWidth()) {
+    case 1: transformBatch<unsigned char>(batch, batch.size_, size); break;
+    case 2: transformBatch<unsigned short>(batch, batch.size_, size); break;
+    default: transformBatch<CatValue>(batch, batch.size_, size); break;
+    }
+
+    batch.size_ += size;
+
+    if (size < wanted) break;
+  }
+
+  return batch.size_;
+}
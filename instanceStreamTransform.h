@@ -0,0 +1,57 @@
+/* Open source system for classification learning from very large data
+** Class for a stream that applies a chain of filters to the instances of a base stream in one step
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "instanceStreamFilter.h"
+#include "instanceBatch.h"
+
+#include <vector>
+
+/// Applies a chain of filters that each map every instance of their source to one instance, such as discretisers
+/// and the class filter, as a single Transform of the instances of the base stream beneath the chain.
+/// Each instance is read once from the base and mapped in one loop, rather than being copied from filter to filter,
+/// and a batch is mapped one column at a time.  The stream has the metadata of the last filter in the chain, and
+/// the filters themselves must continue to exist while it is used.
+class InstanceStreamTransform : public InstanceStreamFilter
+{
+public:
+  InstanceStreamTransform();
+  ~InstanceStreamTransform(void);
+
+  void setTransform(InstanceStream &base, InstanceStream &top, const Transform &t);  ///< map the instances of base by t to those of top, the last filter of the chain
+
+  bool advance(instance &inst);                               ///< advance to the next instance in the stream.  Return true iff successful. @param inst the instance record to receive the new instance.
+  unsigned int advance(InstanceBatch &batch, const unsigned int n);  ///< advance over up to n instances, storing them in the batch.  Return the number stored.
+  void setProjection(const std::vector<bool> &catAtts, const std::vector<bool> &numAtts);  ///< read only the attributes of the base from which the flagged attributes are mapped
+
+private:
+  void advanceSparse(instance &inst);   ///< write the numeric attributes of a sparse base instance to inst
+  template <typename T>
+  void transformBatch(InstanceBatch &batch, const unsigned int start, const unsigned int size);  ///< map the instances of baseBatch_ to those of the batch, whose categorical columns are of type T, from position start
+
+  Transform transform_;                 ///< the mapping from the instances of the base
+  bool baseDiscretises_;                ///< true iff the base discretises its numeric values itself as it reads them
+  std::vector<CatValue> zeroVal_;       ///< for a categorical attribute discretised from a numeric attribute, the value for 0
+  std::vector<CategoricalAttribute> discretisedAs_;  ///< the categorical attribute that discretises each numeric attribute of the base, or NOATT
+  instance baseInst_;                   ///< the current instance of the base
+  InstanceBatch baseBatch_;             ///< the current instances of the base, when the stream is read in batches
+
+  static const CategoricalAttribute NOATT = 0xFFFFFFFFUL; // cannot use std::numeric_limits<CategoricalAttribute>::max() here
+};
@@ -99,7 +99,6 @@ void kdbSelective::train(const instance &inst) {
   if (pass_ == 1) {
     // in the first pass collect the xxy distribution
     dist_.update(inst);
-    trainSize_++; // to calculate the RMSE for each LOOCV
   }
   else if(pass_ == 2){
     // on the second pass collect the distributions to the k-dependence classifier
@@ -189,6 +188,11 @@ void kdbSelective::train(const instance &inst) {
   }
 }
 
+/// train from each instance in the batch in turn, as the later passes evaluate the model on one instance at a time
+void kdbSelective::train(const InstanceBatch &batch) {
+  IncrementalLearner::train(batch);
+}
+
 /// true iff no more passes are required. updated by finalisePass()
 bool kdbSelective::trainingIsFinished() {
     return pass_ > 3;
@@ -214,6 +218,27 @@ void kdbSelective::classify(const instance &inst, std::vector<double> &posterior
   normalise(posteriorDist);
 }
 
+/// classify each instance in the batch in turn, as the selected model is applied to one instance at a time
+void kdbSelective::classify(const InstanceBatch &batch, std::vector<std::vector<double> > &classDists) {
+  learner::classify(batch, classDists);
+}
+
+/// only the selected attributes and their parents are read to classify an instance
+void kdbSelective::getAttsUsed(std::vector<bool> &catAtts, std::vector<bool> &numAtts) {
+  catAtts.assign(noCatAtts_, false);
+  numAtts.clear();
+
+  for (CategoricalAttribute x = 0; x < noCatAtts_; x++) {
+    if (active_[x]) {
+      catAtts[x] = true;
+
+      for (std::vector<CategoricalAttribute>::const_iterator it = parents_[x].begin(); it != parents_[x].end(); it++) {
+        catAtts[*it] = true;
+      }
+    }
+  }
+}
+
 // creates a comparator for two attributes based on their relative mutual information with the class
 class miCmpClass {
 public:
@@ -232,12 +257,14 @@ private:
 
 void kdbSelective::finalisePass() {
   if (pass_ == 1) {
-    
+    // the first pass may be repeated for each block of pairs
+    if (nextBlock()) return;
+
     std::vector<float> mi;  
-    crosstab<float> cmi = crosstab<float>(noCatAtts_);  //CMI(X;Y|C) = H(X|C) - H(X|Y,C) -> cmi[X][Y]
+    crosstab<float> &cmi = cmi_;  //CMI(X;Y|C) = H(X|C) - H(X|Y,C) -> cmi[X][Y]
               
     getMutualInformation(dist_.xyCounts, mi);
-    getCondMutualInf(dist_,cmi);
+    trainSize_ = dist_.xyCounts.count;  // to calculate the RMSE for each LOOCV
     
     dist_.clear();
     
@@ -280,6 +307,8 @@ void kdbSelective::finalisePass() {
          }
        }
     }
+
+    cmi_ = crosstab<float>(0);
   }
   else if(pass_ == 3) {//only for selective KDB
 
@@ -38,11 +38,14 @@ public:
   void reset(InstanceStream &is);   
   void initialisePass(const int pass);
   virtual void train(const instance &inst);
+  virtual void train(const InstanceBatch &batch);
   virtual void finalisePass();
   bool trainingIsFinished();        
   void getCapabilities(capabilities &c);
   
   virtual void classify(const instance &inst, std::vector<double> &classDist);
+  virtual void classify(const InstanceBatch &batch, std::vector<std::vector<double> > &classDists);
+  void getAttsUsed(std::vector<bool> &catAtts, std::vector<bool> &numAtts);  ///< flag the selected attributes and their parents
 
   void printClassifier();
 
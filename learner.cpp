@@ -1,36 +1,51 @@
-/* Open source system for classification learning from very large data
-** Copyright (C) 2012 Geoffrey I Webb
-**
-** This program is free software: you can redistribute it and/or modify
-** it under the terms of the GNU General Public License as published by
-** the Free Software Foundation, either version 3 of the License, or
-** (at your option) any later version.
-** 
-** This program is distributed in the hope that it will be useful,
-** but WITHOUT ANY WARRANTY; without even the implied warranty of
-** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
-** GNU General Public License for more details.
-** 
-** You should have received a copy of the GNU General Public License
-** along with this program. If not, see <http://www.gnu.org/licenses/>.
-**
-** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
-*/
-#include "learner.h"
-#include <assert.h>
-
-learner::learner()
-{
-}
-
-learner::~learner(void)
-{
-}
-
-void learner::testCapabilities(InstanceStream &is){
-  capabilities c;
-  getCapabilities(c);
-  c.testCapabilities(is,name_);
-}
-
-
+/* Open source system for classification learning from very large data
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "learner.h"
+#include <assert.h>
+
+learner::learner()
+{
+}
+
+learner::~learner(void)
+{
+}
+
+/// infer the class distribution for each instance in a batch, one instance at a time
+void learner::classify(const InstanceBatch &batch, std::vector<std::vector<double> > &classDists) {
+  instance inst;
+
+  for (unsigned int i = 0; i < batch.size(); i++) {
+    batch.getInstance(i, inst);
+    classify(inst, classDists[i]);
+  }
+}
+
+void learner::getAttsUsed(std::vector<bool> &catAtts, std::vector<bool> &numAtts) {
+  catAtts.clear();
+  numAtts.clear();
+}
+
+void learner::testCapabilities(InstanceStream &is){
+  capabilities c;
+  getCapabilities(c);
+  c.testCapabilities(is,name_);
+}
+
+
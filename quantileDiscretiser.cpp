@@ -0,0 +1,146 @@
+/* Gigal: An open source system for classification learning from very large data
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "quantileDiscretiser.h"
+#include "utils.h"
+#include "globals.h"
+#include <limits>
+#include <math.h>
+
+quantileDiscretiser::quantileDiscretiser(char*const*& argv, char*const* end)
+{
+  intervals = 10;
+  k_ = QuantileSketch::DEFAULT_K;
+  discType = specifiedIntervals;
+
+  // get arguments
+  while (argv != end) {
+    if (*argv[0] == '-' && argv[0][1] == 'i') {
+      getUIntFromStr(argv[0]+2, intervals, "i");
+      ++argv;
+    }
+    else if (*argv[0] == '-' && argv[0][1] == 'r') {
+      getUIntFromStr(argv[0]+2, root_, "r");
+      discType = npkid;
+      ++argv;
+    }
+    else if (*argv[0] == '-' && argv[0][1] == 'c' && isUIntStr(argv[0]+2)) {
+      getUIntFromStr(argv[0]+2, k_, "c");
+      ++argv;
+    }
+    else if (streq(argv[0]+1, "-squared")) {
+      discType = pkid;
+      ++argv;
+    }
+    else if (streq(argv[0]+1, "-cubed")) {
+      discType = pkidCubed;
+      ++argv;
+    }
+    else {
+      break;
+    }
+  }
+}
+
+quantileDiscretiser::~quantileDiscretiser(void)
+{
+}
+
+/// discretise a sample, as a sketch of its values
+void quantileDiscretiser::discretise(std::vector<NumValue> &vals, const std::vector<CatValue>& /*classes*/, unsigned int /*noOfClasses*/, std::vector<NumValue> &cuts) {
+  QuantileSketch sketch(k_);
+
+  for (size_t i = 0; i < vals.size(); i++) {
+    if (vals[i] != MISSINGNUM) sketch.add(vals[i]);
+  }
+
+  cutSketch(sketch, cuts);
+}
+
+bool quantileDiscretiser::isStreamed() const {
+  return true;
+}
+
+void quantileDiscretiser::startStream(const unsigned int noOfAtts) {
+  sketches_.assign(noOfAtts, QuantileSketch(k_));
+}
+
+void quantileDiscretiser::addValue(const NumericAttribute att, const NumValue v, const InstanceCount weight) {
+  if (v != MISSINGNUM) sketches_[att].add(v, weight);
+}
+
+void quantileDiscretiser::streamedCuts(const NumericAttribute att, std::vector<NumValue> &cuts) {
+  cutSketch(sketches_[att], cuts);
+}
+
+// the cuts are chosen as eqDepthDiscretiser chooses them from a sorted sample, at the values of the estimated ranks
+void quantileDiscretiser::cutSketch(const QuantileSketch &sketch, std::vector<NumValue> &cuts) const {
+  const InstanceCount n = sketch.count();
+
+  if (n == 0) {
+    // need to guard against all values being missing
+    cuts.push_back(0);
+    return;
+  }
+
+  InstanceCount noOfIntervals = intervals > n ? n : intervals;
+  double intervalSize = 0;
+
+  switch (discType) {
+    case specifiedIntervals:
+      intervalSize = n / static_cast<double>(noOfIntervals);
+      break;
+    case pkid:
+      noOfIntervals = static_cast<InstanceCount>(floor(sqrt(static_cast<double>(n))));
+      intervalSize = n / static_cast<double>(noOfIntervals);
+      break;
+    case pkidCubed:
+      noOfIntervals = static_cast<InstanceCount>(floor(pow(static_cast<double>(n), 1.0/3.0)));
+      intervalSize = n / static_cast<double>(noOfIntervals);
+      break;
+    case npkid:
+      noOfIntervals = static_cast<InstanceCount>(floor(pow(static_cast<double>(n), 1.0/root_)));
+      intervalSize = n / static_cast<double>(noOfIntervals);
+      break;
+    default:
+      error("discretisation type not supported");
+  }
+  if (verbosity >= 2)
+    printf("Interval size = %f\n", intervalSize);
+
+  std::vector<NumValue> vals;
+  std::vector<InstanceCount> weights;
+
+  sketch.getSorted(vals, weights);
+
+  NumValue lastVal = std::numeric_limits<NumValue>::max();
+  size_t v = 0;
+  InstanceCount below = weights[0];  // the number of values up to and including vals[v]
+
+  // there is one less cutpoint than there are intervals
+  for (InstanceCount i = 0; i + 1 < noOfIntervals; i++) {
+    const InstanceCount rank = static_cast<InstanceCount>(intervalSize * (i + 1));
+
+    while (below < rank && v + 1 < vals.size()) below += weights[++v];
+
+    if (vals[v] != lastVal && vals[v] < sketch.max()) { // do not duplicate cuts and do not cut on the last value in the input
+      cuts.push_back(vals[v]);
+      lastVal = vals[v];
+    }
+  }
+}
@@ -0,0 +1,53 @@
+/* Gigal: An open source system for classification learning from very large data
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "discretiser.h"
+#include "quantileSketch.h"
+
+#include <vector>
+
+/// Equal frequency discretisation from a QuantileSketch of every value of each attribute, taken in a single pass.
+/// Unlike eqDepthDiscretiser it keeps no sample, so its memory is bounded by the size of the sketches (-c) however many
+/// numeric attributes there are, and the PKID interval counts (--squared, --cubed, -r) are determined by the exact number
+/// of values of the attribute rather than by the sample size.
+class quantileDiscretiser : public discretiser
+{
+public:
+  quantileDiscretiser(char*const*& argv, char*const* end);
+  ~quantileDiscretiser(void);
+
+  virtual void discretise(std::vector<NumValue> &vals, const std::vector<CatValue> &classes, unsigned int noOfClasses, std::vector<NumValue> &cuts); // discretize Attribute att with values vals
+
+  bool isStreamed() const;                                    ///< true, as every value is taken
+  void startStream(const unsigned int noOfAtts);              ///< start an empty sketch for each attribute
+  void addValue(const NumericAttribute att, const NumValue v, const InstanceCount weight);  ///< add a value to the sketch of an attribute, unless it is missing
+  void streamedCuts(const NumericAttribute att, std::vector<NumValue> &cuts);  ///< find the equal frequency cuts of an attribute from its sketch
+
+protected:
+  typedef enum {specifiedIntervals, pkid, pkidCubed, npkid} discretisationType;
+
+  void cutSketch(const QuantileSketch &sketch, std::vector<NumValue> &cuts) const;  ///< find the equal frequency cuts from a sketch
+
+  unsigned int intervals; // the number of intervals into which the data should be discretised
+  unsigned int root_;     ///< the n in the nth-root used to determine the pkdd interval size
+  unsigned int k_;        ///< the capacity of the top level of each sketch
+  discretisationType discType;
+  std::vector<QuantileSketch> sketches_;  ///< the sketch of the values of each attribute
+};
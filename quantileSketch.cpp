@@ -0,0 +1,139 @@
+/* Open source system for classification learning from very large data
+** Class for a bounded memory, mergeable sketch of the quantiles of a stream of values
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "quantileSketch.h"
+
+#include <algorithm>
+#include <limits>
+#include <math.h>
+
+QuantileSketch::QuantileSketch(const unsigned int k)
+  : k_(k < MIN_CAPACITY ? MIN_CAPACITY : k), count_(0), min_(std::numeric_limits<NumValue>::max()), max_(-std::numeric_limits<NumValue>::max())
+{
+}
+
+QuantileSketch::~QuantileSketch(void)
+{
+}
+
+// the capacity of each level is two thirds of the capacity of the level above
+void QuantileSketch::setLevels(const unsigned int noOfLevels) {
+  if (noOfLevels <= levels_.size()) return;
+
+  levels_.resize(noOfLevels);
+  odd_.resize(noOfLevels, false);
+  capacity_.resize(noOfLevels);
+
+  for (unsigned int level = 0; level < noOfLevels; level++) {
+    const double c = ceil(k_ * pow(2.0 / 3.0, static_cast<double>(noOfLevels - 1 - level)));
+
+    capacity_[level] = c < MIN_CAPACITY ? MIN_CAPACITY : static_cast<unsigned int>(c);
+  }
+}
+
+/// add a value that occurs weight times.  Each set bit h of the weight places one copy of the value at level h.
+void QuantileSketch::add(const NumValue v, const InstanceCount weight) {
+  if (weight == 0) return;
+
+  count_ += weight;
+  if (v < min_) min_ = v;
+  if (v > max_) max_ = v;
+
+  if (weight == 1) {
+    setLevels(1);
+    levels_[0].push_back(v);
+    if (levels_[0].size() > capacity_[0]) compress();
+    return;
+  }
+
+  InstanceCount w = weight;
+
+  for (unsigned int level = 0; w != 0; level++, w >>= 1) {
+    if (w & 1) {
+      setLevels(level + 1);
+      levels_[level].push_back(v);
+    }
+  }
+
+  compress();
+}
+
+void QuantileSketch::merge(const QuantileSketch &other) {
+  if (other.count_ == 0) return;
+
+  setLevels(other.levels_.size());
+
+  for (unsigned int level = 0; level < other.levels_.size(); level++) {
+    levels_[level].insert(levels_[level].end(), other.levels_[level].begin(), other.levels_[level].end());
+  }
+
+  count_ += other.count_;
+  if (other.min_ < min_) min_ = other.min_;
+  if (other.max_ > max_) max_ = other.max_;
+
+  compress();
+}
+
+// compact from the lowest level up, as each compaction may overfill the level above
+void QuantileSketch::compress() {
+  for (unsigned int level = 0; level < levels_.size(); level++) {
+    if (levels_[level].size() > capacity_[level]) compact(level);
+  }
+}
+
+void QuantileSketch::compact(const unsigned int level) {
+  setLevels(level + 2);
+
+  std::vector<NumValue> &vals = levels_[level];
+  std::vector<NumValue> &above = levels_[level + 1];
+
+  std::sort(vals.begin(), vals.end());
+
+  // an odd value out stays at this level, so that the weight held is unchanged
+  const size_t first = vals.size() % 2;
+
+  for (size_t i = first + (odd_[level] ? 1 : 0); i < vals.size(); i += 2) {
+    above.push_back(vals[i]);
+  }
+
+  odd_[level] = !odd_[level];
+  vals.resize(first);
+}
+
+void QuantileSketch::getSorted(std::vector<NumValue> &vals, std::vector<InstanceCount> &weights) const {
+  std::vector<std::pair<NumValue, InstanceCount> > held;
+
+  for (unsigned int level = 0; level < levels_.size(); level++) {
+    const InstanceCount w = static_cast<InstanceCount>(1) << level;
+
+    for (size_t i = 0; i < levels_[level].size(); i++) {
+      held.push_back(std::make_pair(levels_[level][i], w));
+    }
+  }
+
+  std::sort(held.begin(), held.end());
+
+  vals.resize(held.size());
+  weights.resize(held.size());
+
+  for (size_t i = 0; i < held.size(); i++) {
+    vals[i] = held[i].first;
+    weights[i] = held[i].second;
+  }
+}
@@ -0,0 +1,65 @@
+/* Open source system for classification learning from very large data
+** Class for a bounded memory, mergeable sketch of the quantiles of a stream of values
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "instanceStream.h"
+
+#include <vector>
+
+/// A sketch of the distribution of a stream of numeric values from which any quantile can be estimated, after
+/// Karnin, Lang and Liberty's KLL sketch.  The values are held in a hierarchy of compactors, each value held at
+/// level h standing for 2^h values of the stream.  When a level holds more than its capacity it is sorted and every
+/// second value (starting alternately from the first and the second) is promoted to the next level, the rest being
+/// discarded.  The top level has capacity k and each level below two thirds of the one above, so the sketch holds
+/// about 3k values however long the stream, and the rank of a value estimated from it is within about 1.7/k of the
+/// number of values in the stream.  The total weight held is always exactly the number of values added, and two
+/// sketches of different streams can be merged into a sketch of both.
+class QuantileSketch
+{
+public:
+  QuantileSketch(const unsigned int k = DEFAULT_K);
+  ~QuantileSketch(void);
+
+  void add(const NumValue v, const InstanceCount weight = 1);   ///< add a value that occurs weight times
+  void merge(const QuantileSketch &other);                     ///< add all the values of another sketch
+
+  inline InstanceCount count() const { return count_; }        ///< the number of values added
+  inline NumValue min() const { return min_; }                 ///< the least value added
+  inline NumValue max() const { return max_; }                 ///< the greatest value added
+
+  /// the values held in ascending order, each with the number of values of the stream it stands for
+  void getSorted(std::vector<NumValue> &vals, std::vector<InstanceCount> &weights) const;
+
+  static const unsigned int DEFAULT_K = 200;  ///< the default capacity of the top level
+  static const unsigned int MIN_CAPACITY = 8;  ///< the least capacity of any level
+
+private:
+  void setLevels(const unsigned int noOfLevels);  ///< add levels until there are noOfLevels, recomputing the capacities
+  void compress();                            ///< compact each level that holds more than its capacity
+  void compact(const unsigned int level);     ///< promote every second value of a level to the level above
+
+  unsigned int k_;                            ///< the capacity of the top level
+  std::vector<std::vector<NumValue> > levels_;  ///< the values held at each level
+  std::vector<unsigned int> capacity_;        ///< the number of values each level may hold before it is compacted
+  std::vector<bool> odd_;                     ///< for each level, true iff its next compaction promotes the second of each pair
+  InstanceCount count_;                       ///< the number of values added
+  NumValue min_;                              ///< the least value added
+  NumValue max_;                              ///< the greatest value added
+};
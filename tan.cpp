@@ -1,149 +1,260 @@
-/* Open source system for classification learning from very large data
- ** Copyright (C) 2012 Geoffrey I Webb
- **
- ** This program is free software: you can redistribute it and/or modify
- ** it under the terms of the GNU General Public License as published by
- ** the Free Software Foundation, either version 3 of the License, or
- ** (at your option) any later version.
- **
- ** This program is distributed in the hope that it will be useful,
- ** but WITHOUT ANY WARRANTY; without even the implied warranty of
- ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
- ** GNU General Public License for more details.
- **
- ** You should have received a copy of the GNU General Public License
- ** along with this program. If not, see <http://www.gnu.org/licenses/>.
- **
- ** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
- */
-#include "tan.h"
-#include "utils.h"
-#include "correlationMeasures.h"
-#include <assert.h>
-#include <math.h>
-#include <set>
-#include <stdlib.h>
-
-TAN::TAN() :
-		trainingIsFinished_(false) {
-}
-
-TAN::TAN(char* const *&, char* const *) :
-	xxyDist_(), trainingIsFinished_(false) {
-	name_ = "TAN";
-}
-
-TAN::~TAN(void) {}
-
-void TAN::reset(InstanceStream &is) {
-	instanceStream_ = &is;
-	const unsigned int noCatAtts = is.getNoCatAtts();
-	noCatAtts_ = noCatAtts;
-	noClasses_ = is.getNoClasses();
-
-	trainingIsFinished_ = false;
-
-        parents_.resize(noCatAtts);
-	for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
-		parents_[a] = NOPARENT;
-	}
-
-	xxyDist_.reset(is);
-}
-
-void TAN::getCapabilities(capabilities &c) {
-	c.setCatAtts(true); // only categorical attributes are supported at the moment
-}
-
-void TAN::initialisePass() {
-	assert(trainingIsFinished_ == false);
-}
-
-void TAN::train(const instance &inst) {
-	xxyDist_.update(inst);
-}
-
-void TAN::classify(const instance &inst, std::vector<double> &classDist) {
-
-	for (CatValue y = 0; y < noClasses_; y++) {
-		classDist[y] = xxyDist_.xyCounts.p(y)* (std::numeric_limits<double>::max() / 2.0);
-	}
-
-	for (unsigned int x1 = 0; x1 < noCatAtts_; x1++) {
-		const CategoricalAttribute parent = parents_[x1];
-
-		if (parent == NOPARENT) {
-			for (CatValue y = 0; y < noClasses_; y++) {
-				classDist[y] *= xxyDist_.xyCounts.p(x1, inst.getCatVal(x1), y);
-			}
-		} else {
-			for (CatValue y = 0; y < noClasses_; y++) {
-				classDist[y] *= xxyDist_.p(x1, inst.getCatVal(x1), parent,
-						inst.getCatVal(parent), y);
-			}
-		}
-	}
-
-	normalise(classDist);
-}
-
-void TAN::finalisePass() {
-	assert(trainingIsFinished_ == false);
-
-	crosstab<float> cmi = crosstab<float>(noCatAtts_);
-	getCondMutualInf(xxyDist_, cmi);
-
-	// find the maximum spanning tree
-
-	CategoricalAttribute firstAtt = 0;
-
-	parents_[firstAtt] = NOPARENT;
-
-	float *maxWeight;
-	CategoricalAttribute *bestSoFar;
-	CategoricalAttribute topCandidate = firstAtt;
-	std::set<CategoricalAttribute> available;
-
-	safeAlloc(maxWeight, noCatAtts_);
-	safeAlloc(bestSoFar, noCatAtts_);
-
-	maxWeight[firstAtt] = -std::numeric_limits<float>::max();
-
-	for (CategoricalAttribute a = firstAtt + 1; a < noCatAtts_; a++) {
-		maxWeight[a] = cmi[firstAtt][a];
-		if (cmi[firstAtt][a] > maxWeight[topCandidate])
-			topCandidate = a;
-		bestSoFar[a] = firstAtt;
-		available.insert(a);
-	}
-
-	while (!available.empty()) {
-		const CategoricalAttribute current = topCandidate;
-		parents_[current] = bestSoFar[current];
-		available.erase(current);
-
-		if (!available.empty()) {
-			topCandidate = *available.begin();
-			for (std::set<CategoricalAttribute>::const_iterator it =
-					available.begin(); it != available.end(); it++) {
-				if (maxWeight[*it] < cmi[current][*it]) {
-					maxWeight[*it] = cmi[current][*it];
-					bestSoFar[*it] = current;
-				}
-
-				if (maxWeight[*it] > maxWeight[topCandidate])
-					topCandidate = *it;
-			}
-		}
-	}
-
-	delete[] bestSoFar;
-	delete[] maxWeight;
-
-	trainingIsFinished_ = true;
-}
-
-/// true iff no more passes are required. updated by finalisePass()
-bool TAN::trainingIsFinished() {
-	return trainingIsFinished_;
-}
+/* Open source system for classification learning from very large data
+ ** Copyright (C) 2012 Geoffrey I Webb
+ **
+ ** This program is free software: you can redistribute it and/or modify
+ ** it under the terms of the GNU General Public License as published by
+ ** the Free Software Foundation, either version 3 of the License, or
+ ** (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ ** GNU General Public License for more details.
+ **
+ ** You should have received a copy of the GNU General Public License
+ ** along with this program. If not, see <http://www.gnu.org/licenses/>.
+ **
+ ** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+ */
+#include "tan.h"
+#include "utils.h"
+#include "correlationMeasures.h"
+#include "globals.h"
+#include <assert.h>
+#include <math.h>
+#include <set>
+#include <stdlib.h>
+
+TAN::TAN() :
+		block_(0), cmi_(0), countingParents_(false), trainingIsFinished_(false) {
+}
+
+TAN::TAN(char* const *&, char* const *) :
+	xxyDist_(), block_(0), cmi_(0), countingParents_(false), trainingIsFinished_(false) {
+	name_ = "TAN";
+}
+
+TAN::~TAN(void) {}
+
+void TAN::reset(InstanceStream &is) {
+	instanceStream_ = &is;
+	const unsigned int noCatAtts = is.getNoCatAtts();
+	noCatAtts_ = noCatAtts;
+	noClasses_ = is.getNoClasses();
+
+	trainingIsFinished_ = false;
+
+        parents_.resize(noCatAtts);
+	for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+		parents_[a] = NOPARENT;
+	}
+
+	xxyDist::getBlocks(is, static_cast<size_t>(xxyBudget) << 20, blocks_);
+
+	if (verbosity >= 2 && blocks_.size() > 2) {
+		printf("Counting the pairs of attributes in %u passes\n", static_cast<unsigned int>(blocks_.size() - 1));
+	}
+
+	block_ = 0;
+	countingParents_ = false;
+	parentCounts_.clear();
+	xxyDist_.reset(is, blocks_[0], blocks_[1]);
+	cmi_ = crosstab<float>(noCatAtts_);
+}
+
+void TAN::getCapabilities(capabilities &c) {
+	c.setCatAtts(true); // only categorical attributes are supported at the moment
+}
+
+void TAN::initialisePass() {
+	assert(trainingIsFinished_ == false);
+}
+
+void TAN::train(const instance &inst) {
+	xxyDist_.update(inst);
+	if (countingParents_) countParents(inst);
+}
+
+void TAN::train(const InstanceBatch &batch) {
+	if (countingParents_) IncrementalLearner::train(batch);
+	else xxyDist_.update(batch);
+}
+
+void TAN::train(const InstanceBatch &batch, WorkerPool &pool) {
+	if (countingParents_) train(batch);
+	else xxyDist_.update(batch, pool);
+}
+
+// the pass that counts each attribute with its parent is read from the stream
+bool TAN::trainFromCounts(InstanceStream &is, WorkerPool *pool) {
+	return !countingParents_ && is.countPairs(xxyDist_, pool);
+}
+
+void TAN::countParents(const instance &inst) {
+	for (CategoricalAttribute x1 = 0; x1 < noCatAtts_; x1++) {
+		const CategoricalAttribute parent = parents_[x1];
+
+		if (parent != NOPARENT) {
+			parentCounts_[x1][(static_cast<size_t>(inst.getCatVal(x1))*xxyDist_.getNoValues(parent) + inst.getCatVal(parent))*noClasses_ + inst.getClass()]++;
+		}
+	}
+}
+
+void TAN::classify(const instance &inst, std::vector<double> &classDist) {
+
+	for (CatValue y = 0; y < noClasses_; y++) {
+		classDist[y] = xxyDist_.xyCounts.p(y)* (std::numeric_limits<double>::max() / 2.0);
+	}
+
+	for (unsigned int x1 = 0; x1 < noCatAtts_; x1++) {
+		const CategoricalAttribute parent = parents_[x1];
+
+		if (parent == NOPARENT) {
+			for (CatValue y = 0; y < noClasses_; y++) {
+				classDist[y] *= xxyDist_.xyCounts.p(x1, inst.getCatVal(x1), y);
+			}
+		} else {
+			for (CatValue y = 0; y < noClasses_; y++) {
+				classDist[y] *= p(x1, inst.getCatVal(x1), parent,
+						inst.getCatVal(parent), y);
+			}
+		}
+	}
+
+	normalise(classDist);
+}
+
+void TAN::classify(const InstanceBatch &batch, std::vector<std::vector<double> > &classDists) {
+	switch (batch.getCatWidth()) {
+	case 1: classifyCols<unsigned char>(batch, classDists); break;
+	case 2: classifyCols<unsigned short>(batch, classDists); break;
+	default: classifyCols<CatValue>(batch, classDists); break;
+	}
+}
+
+template <typename T>
+void TAN::classifyCols(const InstanceBatch &batch, std::vector<std::vector<double> > &classDists) {
+
+	for (unsigned int i = 0; i < batch.size(); i++) {
+		for (CatValue y = 0; y < noClasses_; y++) {
+			classDists[i][y] = xxyDist_.xyCounts.p(y)* (std::numeric_limits<double>::max() / 2.0);
+		}
+	}
+
+	for (unsigned int x1 = 0; x1 < noCatAtts_; x1++) {
+		const CategoricalAttribute parent = parents_[x1];
+		const T *x1Vals = batch.getCatCol<T>(x1);
+
+		if (parent == NOPARENT) {
+			for (unsigned int i = 0; i < batch.size(); i++) {
+				for (CatValue y = 0; y < noClasses_; y++) {
+					classDists[i][y] *= xxyDist_.xyCounts.p(x1, x1Vals[i], y);
+				}
+			}
+		} else {
+			const T *parentVals = batch.getCatCol<T>(parent);
+
+			for (unsigned int i = 0; i < batch.size(); i++) {
+				for (CatValue y = 0; y < noClasses_; y++) {
+					classDists[i][y] *= p(x1, x1Vals[i], parent,
+							parentVals[i], y);
+				}
+			}
+		}
+	}
+
+	for (unsigned int i = 0; i < batch.size(); i++) {
+		normalise(classDists[i]);
+	}
+}
+
+void TAN::finalisePass() {
+	assert(trainingIsFinished_ == false);
+
+	if (countingParents_) {
+		trainingIsFinished_ = true;
+		return;
+	}
+
+	// the conditional mutual information is calculated a block of pairs at a time, each block taking a pass
+	getCondMutualInf(xxyDist_, cmi_);
+
+	if (++block_ + 1 < blocks_.size()) {
+		xxyDist_.reset(*instanceStream_, blocks_[block_], blocks_[block_ + 1]);
+		return;
+	}
+
+	crosstab<float> &cmi = cmi_;
+
+	// find the maximum spanning tree
+
+	CategoricalAttribute firstAtt = 0;
+
+	parents_[firstAtt] = NOPARENT;
+
+	float *maxWeight;
+	CategoricalAttribute *bestSoFar;
+	CategoricalAttribute topCandidate = firstAtt;
+	std::set<CategoricalAttribute> available;
+
+	safeAlloc(maxWeight, noCatAtts_);
+	safeAlloc(bestSoFar, noCatAtts_);
+
+	maxWeight[firstAtt] = -std::numeric_limits<float>::max();
+
+	for (CategoricalAttribute a = firstAtt + 1; a < noCatAtts_; a++) {
+		maxWeight[a] = cmi[firstAtt][a];
+		if (cmi[firstAtt][a] > maxWeight[topCandidate])
+			topCandidate = a;
+		bestSoFar[a] = firstAtt;
+		available.insert(a);
+	}
+
+	while (!available.empty()) {
+		const CategoricalAttribute current = topCandidate;
+		parents_[current] = bestSoFar[current];
+		available.erase(current);
+
+		if (!available.empty()) {
+			topCandidate = *available.begin();
+			for (std::set<CategoricalAttribute>::const_iterator it =
+					available.begin(); it != available.end(); it++) {
+				if (maxWeight[*it] < cmi[current][*it]) {
+					maxWeight[*it] = cmi[current][*it];
+					bestSoFar[*it] = current;
+				}
+
+				if (maxWeight[*it] > maxWeight[topCandidate])
+					topCandidate = *it;
+			}
+		}
+	}
+
+	delete[] bestSoFar;
+	delete[] maxWeight;
+
+	cmi_ = crosstab<float>(0);
+
+	if (blocks_.size() > 2) {
+		// the pairs of each attribute with its parent are no longer held, so count them in one more pass
+		parentCounts_.resize(noCatAtts_);
+		for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+			if (parents_[a] != NOPARENT) {
+				parentCounts_[a].assign(static_cast<size_t>(xxyDist_.getNoValues(a))*xxyDist_.getNoValues(parents_[a])*noClasses_, 0);
+			}
+		}
+
+		// release the counts of the blocks and hold an empty block, so that the pass counts just the xy distribution
+		xxyDist_.clear();
+		xxyDist_.reset(*instanceStream_, 1, 1);
+		countingParents_ = true;
+		return;
+	}
+
+	trainingIsFinished_ = true;
+}
+
+/// true iff no more passes are required. updated by finalisePass()
+bool TAN::trainingIsFinished() {
+	return trainingIsFinished_;
+}
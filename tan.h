@@ -1,79 +1,99 @@
-/* Open source system for classification learning from very large data
- ** Copyright (C) 2012 Geoffrey I Webb
- **
- ** This program is free software: you can redistribute it and/or modify
- ** it under the terms of the GNU General Public License as published by
- ** the Free Software Foundation, either version 3 of the License, or
- ** (at your option) any later version.
- **
- ** This program is distributed in the hope that it will be useful,
- ** but WITHOUT ANY WARRANTY; without even the implied warranty of
- ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
- ** GNU General Public License for more details.
- **
- ** You should have received a copy of the GNU General Public License
- ** along with this program. If not, see <http://www.gnu.org/licenses/>.
- **
- ** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
- */
-#pragma once
-
-#include "incrementalLearner.h"
-#include "xxyDist.h"
-#include <limits>
-/**
-<!-- globalinfo-start -->
- * Class for a Tree AugmeNted (TAN) Classifier .<br/>
- * <br/>
- * For more information on TAN classifiers, see:<br/>
- * <br/>
- * N. Friedman, D. Geiger and M. Goldszmidt: Bayesian network classifiers. In: 
- * Machine Learning, number 2-3, vol. 29, 131-163, 1997.
- <!-- globalinfo-end -->
- *
- <!-- technical-bibtex-start -->
- * BibTeX:
- * <pre>
- * \@article{Friedman1997,
- *   author = {N. Friedman and D. Geiger and M. Goldszmidt},
- *   journal = {Machine Learning},
- *   number = {2-3},
- *   pages = {131-163},
- *   title = {Bayesian network classifiers},
- *   volume = {29},
- *   year = {1997}
- *}
- * </pre>
- <!-- technical-bibtex-end -->
- *
- *
- * @author Geoff Webb (geoff.webb@monash.edu)
- */
- 
-class TAN: public IncrementalLearner {
-public:
-	TAN();
-	TAN(char* const *& argv, char* const * end);
-	~TAN(void);
-
-	void reset(InstanceStream &is);   ///< reset the learner prior to training
-	void initialisePass(); ///< must be called to initialise a pass through an instance stream before calling train(const instance). should not be used with train(InstanceStream)
-	void train(const instance &inst); ///< primary training method. train from a single instance. used in conjunction with initialisePass and finalisePass
-	void finalisePass(); ///< must be called to finalise a pass through an instance stream using train(const instance). should not be used with train(InstanceStream)
-	bool trainingIsFinished(); ///< true iff no more passes are required. updated by finalisePass()
-	void getCapabilities(capabilities &c);
-
-	virtual void classify(const instance &inst, std::vector<double> &classDist);
-
-private:
-	unsigned int noCatAtts_;          ///< the number of categorical attributes.
-	unsigned int noClasses_;                          ///< the number of classes
-
-	InstanceStream* instanceStream_;
-	std::vector<CategoricalAttribute> parents_;
-	xxyDist xxyDist_;
-
-	bool trainingIsFinished_; ///< true iff the learner is trained
-
-	const static CategoricalAttribute NOPARENT = 0xFFFFFFFFUL; // cannot use std::numeric_limits<categoricalAttribute>::max() because some compilers will not allow it here
-};
+/* Open source system for classification learning from very large data
+ ** Copyright (C) 2012 Geoffrey I Webb
+ **
+ ** This program is free software: you can redistribute it and/or modify
+ ** it under the terms of the GNU General Public License as published by
+ ** the Free Software Foundation, either version 3 of the License, or
+ ** (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ ** GNU General Public License for more details.
+ **
+ ** You should have received a copy of the GNU General Public License
+ ** along with this program. If not, see <http://www.gnu.org/licenses/>.
+ **
+ ** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+ */
+#pragma once
+
+#include "incrementalLearner.h"
+#include "crosstab.h"
+#include "xxyDist.h"
+#include <limits>
+/**
+<!-- globalinfo-start -->
+ * Class for a Tree AugmeNted (TAN) Classifier .<br/>
+ * <br/>
+ * For more information on TAN classifiers, see:<br/>
+ * <br/>
+ * N. Friedman, D. Geiger and M. Goldszmidt: Bayesian network classifiers. In: 
+ * Machine Learning, number 2-3, vol. 29, 131-163, 1997.
+ <!-- globalinfo-end -->
+ *
+ <!-- technical-bibtex-start -->
+ * BibTeX:
+ * <pre>
+ * \@article{Friedman1997,
+ *   author = {N. Friedman and D. Geiger and M. Goldszmidt},
+ *   journal = {Machine Learning},
+ *   number = {2-3},
+ *   pages = {131-163},
+ *   title = {Bayesian network classifiers},
+ *   volume = {29},
+ *   year = {1997}
+ *}
+ * </pre>
+ <!-- technical-bibtex-end -->
+ *
+ *
+ * @author Geoff Webb (geoff.webb@monash.edu)
+ */
+ 
+class TAN: public IncrementalLearner {
+public:
+	TAN();
+	TAN(char* const *& argv, char* const * end);
+	~TAN(void);
+
+	void reset(InstanceStream &is);   ///< reset the learner prior to training
+	void initialisePass(); ///< must be called to initialise a pass through an instance stream before calling train(const instance). should not be used with train(InstanceStream)
+	void train(const instance &inst); ///< primary training method. train from a single instance. used in conjunction with initialisePass and finalisePass
+	void train(const InstanceBatch &batch); ///< train from each instance in a batch, one pair of attributes at a time
+	void train(const InstanceBatch &batch, WorkerPool &pool); ///< train from a batch, the workers of the pool sharing the pairs of attributes
+	bool trainFromCounts(InstanceStream &is, WorkerPool *pool); ///< count the pairs of attributes from the stream, if it can provide them without a pass
+	void finalisePass(); ///< must be called to finalise a pass through an instance stream using train(const instance). should not be used with train(InstanceStream)
+	bool trainingIsFinished(); ///< true iff no more passes are required. updated by finalisePass()
+	void getCapabilities(capabilities &c);
+
+	virtual void classify(const instance &inst, std::vector<double> &classDist);
+	virtual void classify(const InstanceBatch &batch, std::vector<std::vector<double> > &classDists); ///< classify each instance in a batch, one attribute at a time
+
+private:
+	template <typename T>
+	void classifyCols(const InstanceBatch &batch, std::vector<std::vector<double> > &classDists); ///< classify a batch whose categorical columns are of type T
+	void countParents(const instance &inst); ///< count each attribute of an instance with its parent and the class
+
+	/// p(x1=v1|Y=y, parent=vp) using M-estimate, from the pair counts or, if they were counted in blocks, from the counts of x1 with its parent
+	inline double p(const CategoricalAttribute x1, const CatValue v1, const CategoricalAttribute parent, const CatValue vp, const CatValue y) const {
+		if (parentCounts_.empty()) return xxyDist_.p(x1, v1, parent, vp, y);
+		return (parentCounts_[x1][(static_cast<size_t>(v1)*xxyDist_.getNoValues(parent) + vp)*noClasses_ + y]+M/xxyDist_.getNoValues(x1))/(xxyDist_.xyCounts.getCount(parent, vp, y)+M);
+	}
+
+	unsigned int noCatAtts_;          ///< the number of categorical attributes.
+	unsigned int noClasses_;                          ///< the number of classes
+
+	InstanceStream* instanceStream_;
+	std::vector<CategoricalAttribute> parents_;
+	xxyDist xxyDist_;
+	std::vector<CategoricalAttribute> blocks_; ///< block b holds the pairs for x1 in [blocks_[b], blocks_[b+1]), each block being counted in its own pass (see -xxybudget)
+	unsigned int block_; ///< the block counted in the current pass
+	crosstab<float> cmi_; ///< the conditional mutual information of the pairs counted so far
+	bool countingParents_; ///< true in the pass that follows the blocks, counting each attribute with its parent
+	std::vector<std::vector<InstanceCount> > parentCounts_; ///< when the pairs are counted in blocks, the counts of x1=v1, parent=vp, y for each attribute x1 with a parent
+
+	bool trainingIsFinished_; ///< true iff the learner is trained
+
+	const static CategoricalAttribute NOPARENT = 0xFFFFFFFFUL; // cannot use std::numeric_limits<categoricalAttribute>::max() because some compilers will not allow it here
+};
@@ -0,0 +1,106 @@
+/* Open source system for classification learning from very large data
+** Class for a pool of threads that run a task in parallel
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "workerPool.h"
+#include "utils.h"
+
+WorkerPool::WorkerPool(const unsigned int noWorkers)
+  : noWorkers_(noWorkers == 0 ? 1 : noWorkers), task_(NULL), generation_(0), pending_(0), stop_(false)
+{ pthread_mutex_init(&mutex_, NULL);
+  pthread_cond_init(&start_, NULL);
+  pthread_cond_init(&done_, NULL);
+
+  threads_.resize(noWorkers_ - 1);
+  args_.resize(noWorkers_ - 1);
+
+  for (unsigned int i = 0; i < threads_.size(); i++) {
+    args_[i].pool = this;
+    args_[i].worker = i + 1;
+
+    if (pthread_create(&threads_[i], NULL, threadMain, &args_[i]) != 0) {
+      error("Cannot create thread %u", i + 1);
+    }
+  }
+}
+
+WorkerPool::~WorkerPool(void)
+{ pthread_mutex_lock(&mutex_);
+  stop_ = true;
+  pthread_cond_broadcast(&start_);
+  pthread_mutex_unlock(&mutex_);
+
+  for (unsigned int i = 0; i < threads_.size(); i++) {
+    pthread_join(threads_[i], NULL);
+  }
+
+  pthread_cond_destroy(&done_);
+  pthread_cond_destroy(&start_);
+  pthread_mutex_destroy(&mutex_);
+}
+
+void *WorkerPool::threadMain(void *arg) {
+  WorkerArg *a = static_cast<WorkerArg*>(arg);
+
+  a->pool->workerLoop(a->worker);
+
+  return NULL;
+}
+
+void WorkerPool::workerLoop(const unsigned int worker) {
+  unsigned long seen = 0;
+
+  pthread_mutex_lock(&mutex_);
+
+  while (true) {
+    while (generation_ == seen && !stop_) pthread_cond_wait(&start_, &mutex_);
+
+    if (stop_) break;
+
+    seen = generation_;
+    Task *task = task_;
+
+    pthread_mutex_unlock(&mutex_);
+    task->run(worker);
+    pthread_mutex_lock(&mutex_);
+
+    if (--pending_ == 0) pthread_cond_signal(&done_);
+  }
+
+  pthread_mutex_unlock(&mutex_);
+}
+
+void WorkerPool::run(Task &task) {
+  if (threads_.empty()) {
+    task.run(0);
+    return;
+  }
+
+  pthread_mutex_lock(&mutex_);
+  task_ = &task;
+  pending_ = threads_.size();
+  generation_++;
+  pthread_cond_broadcast(&start_);
+  pthread_mutex_unlock(&mutex_);
+
+  task.run(0);
+
+  pthread_mutex_lock(&mutex_);
+  while (pending_ != 0) pthread_cond_wait(&done_, &mutex_);
+  pthread_mutex_unlock(&mutex_);
+}
@@ -0,0 +1,62 @@
+/* Open source system for classification learning from very large data
+** Class for a pool of threads that run a task in parallel
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include <pthread.h>
+#include <vector>
+
+/// A fixed set of threads, each of which runs its share of a task when the task is run.
+/// The calling thread acts as worker 0 so a pool of n workers creates n-1 threads.
+class WorkerPool
+{
+public:
+  /// a task to be run in parallel.  run is called once for each worker.
+  class Task {
+  public:
+    virtual ~Task() {}
+    virtual void run(const unsigned int worker) = 0;  ///< perform the part of the task for a worker
+  };
+
+  WorkerPool(const unsigned int noWorkers);
+  ~WorkerPool(void);
+
+  void run(Task &task);                                         ///< run a task on every worker and wait until all have finished
+  inline unsigned int size() const { return noWorkers_; }       ///< the number of workers
+
+private:
+  struct WorkerArg {
+    WorkerPool *pool;
+    unsigned int worker;
+  };
+
+  static void *threadMain(void *arg);   ///< the entry point for a thread
+  void workerLoop(const unsigned int worker);
+
+  const unsigned int noWorkers_;        ///< the number of workers, including the calling thread
+  std::vector<pthread_t> threads_;      ///< the threads for workers 1..noWorkers_-1
+  std::vector<WorkerArg> args_;         ///< the arguments passed to each thread
+  pthread_mutex_t mutex_;               ///< protects the following members
+  pthread_cond_t start_;                ///< signalled when a task is started
+  pthread_cond_t done_;                 ///< signalled when the last worker finishes a task
+  Task *task_;                          ///< the task being run
+  unsigned long generation_;            ///< incremented each time a task is started
+  unsigned int pending_;                ///< the number of threads that have not finished the current task
+  bool stop_;                           ///< true when the threads should exit
+};
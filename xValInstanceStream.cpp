@@ -1,98 +1,334 @@
-#include "xValInstanceStream.h"
-
-XValInstanceStream::XValInstanceStream(InstanceStream *source, const unsigned int noOfFolds, const unsigned int seed)
-  : source_(source), noOfFolds_(noOfFolds), seed_(seed)
-{ metaData_ = source->getMetaData();
-  startSubstream(0, true);
-}
-
-XValInstanceStream::~XValInstanceStream(void)
-{
-}
-
-/// start training or testing for a new fold
-void XValInstanceStream::startSubstream(const unsigned int fold, const bool training) {
-  fold_ = fold;
-  training_ = training;
-  rewind();
-}
-
-/// return to the first instance in the stream
-void XValInstanceStream::rewind() {
-  source_->rewind();
-  rand_.seed(seed_);
-  count_ = 0;
-}
-
-/// advance, discarding the next instance in the stream.  Return true iff successful.
-bool XValInstanceStream::advance() {
-  while (source_->advance()) {
-    if (rand_() % noOfFolds_ == fold_) {
-      // test instance
-      if (!training_) {
-        count_++;
-        return true;
-      }
-    }
-    else {
-      // training instance
-      if (training_) {
-        count_++;
-        return true;
-      }
-    }
-  }
-  return false;
-}
-
-/// advance to the next instance in the stream.Return true iff successful. @param inst the instance record to receive the new instance. 
-bool XValInstanceStream::advance(instance &inst) {
-  while (!source_->isAtEnd()) {
-    if (rand_() % noOfFolds_ == fold_) {
-      // test instance
-      if (training_) {
-        source_->advance();
-      }
-      else {
-        // testing
-        if (source_->advance(inst)) {
-          count_++;
-          return true;
-        }
-        else return false;
-      }
-    }
-    else {
-      // training instance
-      if (training_) {
-        if (source_->advance(inst)) {
-          count_++;
-          return true;
-        }
-        else return false;
-      }
-      else {
-        // testing
-        source_->advance();
-      }
-    }
-  }
-  return false;
-}
-
-/// true if we have advanced past the last instance
-bool XValInstanceStream::isAtEnd() {
-  return source_->isAtEnd();
-}
-
-/// the number of instances in the stream. This may require a pass through the stream to determine so should be used only if absolutely necessary.  The stream state is undefined after a call to size(), so a rewind shouldbe performed before the next advance.
-InstanceCount XValInstanceStream::size() {
-  if (!isAtEnd()) {
-    instance inst(*this);
-
-    while (!isAtEnd()) advance(inst);
-  }
-
-  return count_;
-}
-
+#include "xValInstanceStream.h"
+#include "utils.h"
+#include "bitmapIndex.h"
+#include "xxyDist.h"
+
+#include <limits>
+
+XValInstanceStream::XValInstanceStream(InstanceStream *source, const unsigned int noOfFolds, const unsigned int seed)
+  : source_(source), seed_(seed), noOfFolds_(noOfFolds), testFold_(source, NULL), heldFold_(noOfFolds), holding_(false), fromHeld_(false), canHold_(true),
+    sampleSize_(0), samplesWanted_(false), sampling_(false), samplesReady_(false)
+{ metaData_ = source->getMetaData();
+
+  if (noOfFolds > std::numeric_limits<unsigned short>::max() + 1U) {
+    error("Cross validation supports at most %u folds", std::numeric_limits<unsigned short>::max() + 1U);
+  }
+
+  rand_.seed(seed_);
+  heldInst_.init(*source);
+  startSubstream(0, true);
+}
+
+XValInstanceStream::~XValInstanceStream(void)
+{
+}
+
+/// start training or testing for a new fold
+void XValInstanceStream::startSubstream(const unsigned int fold, const bool training) {
+  fold_ = fold;
+  training_ = training;
+  rewind();
+}
+
+/// return to the first instance in the stream
+void XValInstanceStream::rewind() {
+  count_ = 0;
+  next_ = 0;
+
+  fromHeld_ = !training_ && heldFold_ == fold_;
+
+  if (fromHeld_) {
+    testFold_.rewind();
+    return;
+  }
+
+  source_->rewind();
+
+  // a training pass holds the instances of the test fold, unless they are already held
+  holding_ = training_ && canHold_ && heldFold_ != fold_;
+
+  if (holding_) {
+    testFold_.reload(NULL);
+    heldFold_ = noOfFolds_;
+  }
+
+  sampling_ = training_ && samplesWanted_ && !samplesReady_;
+
+  if (sampling_) startSamples();
+}
+
+void XValInstanceStream::startSamples() {
+  for (unsigned int f = 0; f < noOfFolds_; f++) {
+    sampleVals_[f].clear();
+    sampleClasses_[f].clear();
+    sampleSeen_[f] = 0;
+    sampleRand_[f]->seed(5489UL);  // the default seed, as used by a filter taking its sample by a pass
+  }
+}
+
+void XValInstanceStream::stopSamples() {
+  sampling_ = false;
+
+  for (unsigned int f = 0; f < noOfFolds_; f++) {
+    std::vector<NumValue>().swap(sampleVals_[f]);
+    std::vector<CatValue>().swap(sampleClasses_[f]);
+  }
+}
+
+// the reservoir sampling of the training instances of each fold, as InstanceStreamDiscretiser::setSource takes its sample
+void XValInstanceStream::addToSamples(const instance &inst, const unsigned int fold) {
+  const unsigned int noNumAtts = getNoNumAtts();
+
+  for (unsigned int f = 0; f < noOfFolds_; f++) {
+    if (f == fold) continue;
+
+    const InstanceCount seen = ++sampleSeen_[f];
+    const unsigned long index = seen <= sampleSize_ ? seen - 1 : (*sampleRand_[f])(seen);
+
+    if (index < sampleSize_) {
+      std::vector<NumValue> &vals = sampleVals_[f];
+
+      if (index == sampleClasses_[f].size()) {
+        sampleClasses_[f].push_back(0);
+        vals.resize(vals.size() + noNumAtts);
+      }
+
+      sampleClasses_[f][index] = inst.getClass();
+
+      NumValue *slot = noNumAtts == 0 ? NULL : &vals[index * noNumAtts];
+
+      if (inst.isSparse()) {
+        std::fill(slot, slot + noNumAtts, 0.0f);
+        for (unsigned int i = 0; i < inst.getNoNonZero(); i++) {
+          slot[inst.getNonZeroAtt(i)] = inst.getNonZeroVal(i);
+        }
+      }
+      else {
+        for (NumericAttribute a = 0; a < noNumAtts; a++) {
+          slot[a] = inst.getNumVal(a);
+        }
+      }
+    }
+  }
+}
+
+/// the sample of the training fold, if it has been collected.  The first request for a sample arranges for the pass the caller
+/// then makes to collect the samples of every fold, provided they fit within MAX_SAMPLE_BYTES.
+bool XValInstanceStream::sample(const InstanceCount n, const bool, std::vector<instance> &insts) {
+  if (samplesReady_ && training_ && n == sampleSize_) {
+    const unsigned int noNumAtts = getNoNumAtts();
+    const std::vector<NumValue> &vals = sampleVals_[fold_];
+    const std::vector<CatValue> &classes = sampleClasses_[fold_];
+
+    insts.resize(classes.size());
+
+    for (unsigned int i = 0; i < classes.size(); i++) {
+      insts[i].init(*this);
+      setDense(insts[i]);
+      setClass(insts[i], classes[i]);
+
+      for (NumericAttribute a = 0; a < noNumAtts; a++) {
+        setNumVal(insts[i], a, vals[static_cast<size_t>(i) * noNumAtts + a]);
+      }
+    }
+
+    return true;
+  }
+
+  if (!samplesWanted_ && static_cast<double>(noOfFolds_) * n * (getNoNumAtts() * sizeof(NumValue) + sizeof(CatValue)) <= MAX_SAMPLE_BYTES) {
+    samplesWanted_ = true;
+    sampleSize_ = n;
+    sampleVals_.resize(noOfFolds_);
+    sampleClasses_.resize(noOfFolds_);
+    sampleSeen_.resize(noOfFolds_);
+
+    for (unsigned int f = 0; f < noOfFolds_; f++) {
+      sampleRand_.push_back(new MTRand_int32);
+    }
+  }
+
+  return false;
+}
+
+/// count the pairs of attributes of the substream from the bitmap index of the source, if it keeps one, restricted to the
+/// instances of the substream by a mask.  The folds of instances not yet read are drawn in order, as a pass would draw them.
+bool XValInstanceStream::countPairs(xxyDist &dist, WorkerPool *pool) {
+  BitmapIndex *index = source_->getBitmapIndex();
+
+  if (index == NULL) return false;
+
+  std::vector<unsigned long long> mask(index->getNoWords(), 0);
+
+  for (InstanceCount i = 0; i < index->size(); i++) {
+    if ((foldOf(i) == fold_) != training_) mask[static_cast<size_t>(i >> 6)] |= 1ULL << (i & 63);
+  }
+
+  const unsigned long long *bits = mask.empty() ? NULL : &mask[0];
+
+  if (pool != NULL) dist.update(*index, bits, *pool);
+  else dist.update(*index, bits);
+
+  return true;
+}
+
+bool XValInstanceStream::skip() {
+  const unsigned int fold = foldOf(next_);
+  const bool inTestFold = fold == fold_;
+
+  next_++;
+
+  if (sampling_) {
+    if (!source_->advance(heldInst_)) return false;
+
+    addToSamples(heldInst_, fold);
+
+    if (!holding_ || !inTestFold) return true;
+  }
+  else if (holding_ && inTestFold) {
+    if (!source_->advance(heldInst_)) return false;
+  }
+
+  if (holding_ && inTestFold) {
+    testFold_.hold(heldInst_);
+
+    if (testFold_.getBytes() > MAX_HELD_BYTES) {
+      // the test folds are too large to hold, so read them from the source
+      holding_ = false;
+      canHold_ = false;
+      testFold_.reload(NULL);
+    }
+
+    return true;
+  }
+
+  return source_->advance();
+}
+
+void XValInstanceStream::endOfSource() {
+  if (holding_) {
+    testFold_.finishHold();
+    heldFold_ = fold_;
+    holding_ = false;
+  }
+
+  if (sampling_) {
+    samplesReady_ = true;
+    sampling_ = false;
+  }
+}
+
+/// advance, discarding the next instance in the stream.  Return true iff successful.
+bool XValInstanceStream::advance() {
+  if (fromHeld_) {
+    if (!testFold_.advance()) return false;
+    count_++;
+    return true;
+  }
+
+  if (sampling_) stopSamples();
+
+  while (!source_->isAtEnd()) {
+    if ((foldOf(next_) == fold_) != training_) {
+      next_++;
+      if (source_->advance()) {
+        count_++;
+        return true;
+      }
+      break;
+    }
+    else if (!skip()) break;
+  }
+
+  endOfSource();
+  return false;
+}
+
+/// advance to the next instance in the stream.Return true iff successful. @param inst the instance record to receive the new instance. 
+bool XValInstanceStream::advance(instance &inst) {
+  if (fromHeld_) {
+    if (!testFold_.advance(inst)) return false;
+    count_++;
+    return true;
+  }
+
+  while (!source_->isAtEnd()) {
+    if ((foldOf(next_) == fold_) != training_) {
+      next_++;
+      if (source_->advance(inst)) {
+        if (sampling_) addToSamples(inst, folds_[next_ - 1]);
+        count_++;
+        return true;
+      }
+      break;
+    }
+    else if (!skip()) break;
+  }
+
+  endOfSource();
+  return false;
+}
+
+/// advance over up to n instances, storing them in the batch.  The held instances of a test fold are stored a column at a time.
+unsigned int XValInstanceStream::advance(InstanceBatch &batch, const unsigned int n) {
+  if (!fromHeld_) return InstanceStream::advance(batch, n);
+
+  const unsigned int size = testFold_.advance(batch, n);
+
+  count_ += size;
+
+  return size;
+}
+
+bool XValInstanceStream::canAdvanceDiscretised() {
+  return source_->canAdvanceDiscretised();
+}
+
+/// advance to the next instance in the stream, discretised by the source.  Return true iff successful.
+bool XValInstanceStream::advanceDiscretised(instance &inst, const Cuts &cuts) {
+  if (fromHeld_) {
+    if (!testFold_.advanceDiscretised(inst, cuts)) return false;
+    count_++;
+    return true;
+  }
+
+  if (sampling_) stopSamples();
+
+  while (!source_->isAtEnd()) {
+    if ((foldOf(next_) == fold_) != training_) {
+      next_++;
+      if (source_->advanceDiscretised(inst, cuts)) {
+        count_++;
+        return true;
+      }
+      break;
+    }
+    else if (!skip()) break;
+  }
+
+  endOfSource();
+  return false;
+}
+
+/// true if we have advanced past the last instance
+bool XValInstanceStream::isAtEnd() {
+  if (fromHeld_) return testFold_.isAtEnd();
+
+  if (source_->isAtEnd()) {
+    endOfSource();
+    return true;
+  }
+
+  return false;
+}
+
+/// the number of instances in the stream. This may require a pass through the stream to determine so should be used only if absolutely necessary.  The stream state is undefined after a call to size(), so a rewind shouldbe performed before the next advance.
+InstanceCount XValInstanceStream::size() {
+  if (!isAtEnd()) {
+    instance inst(*this);
+
+    while (!isAtEnd()) advance(inst);
+  }
+
+  return count_;
+}
+
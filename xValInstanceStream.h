@@ -1,30 +1,79 @@
-#pragma once
-#include "instanceStream.h"
-#include "mtrand.h"
-
-class XValInstanceStream :
-  public InstanceStream
-{
-public:
-  XValInstanceStream(InstanceStream *source, const unsigned int noOfFolds, const unsigned int seed = 0);
-  ~XValInstanceStream(void);
-
-  // implementation of core InstanceStream methods
-  void rewind();                                              ///< return to the first instance in the stream
-  bool advance();                                             ///< advance, discarding the next instance in the stream.  Return true iff successful.
-  bool advance(instance &inst);                               ///< advance to the next instance in the stream.  Return true iff successful. @param inst the instance record to receive the new instance. 
-  bool isAtEnd();                                             ///< true if we have advanced past the last instance
-  InstanceCount size();                                       ///< the number of instances in the stream.  This may require a pass through the stream to determine so should be used only if absolutely necessary.
-
-  // cross validation specific methods
-  void startSubstream(const unsigned int fold, const bool training);      ///< start training or testing for a new fold
-
-private:
-  InstanceStream* source_;       ///< the source stream
-  MTRand_int32 rand_;            ///< random number generator for selecting folds
-  const unsigned int seed_;      ///< the random number seed
-  const unsigned int noOfFolds_; ///< the number of folds
-  unsigned int fold_;            ///< the current fold
-  bool training_;                ///< true if the current pass is a training pass. If true, the stream returns instances from the training fold. If false, the stream returns instances from all folds other than the training fold.
-  InstanceCount count_;          ///< a count of the number of instances in the stream
-};
+#pragma once
+#include "instanceStream.h"
+#include "instanceStreamMemory.h"
+#include "mtrand.h"
+#include "utils.h"
+
+/// The instances of a source stream that fall in the training or the test fold of a cross validation.
+/// Each instance of the source is assigned to a fold by drawing from a random number generator seeded with the seed,
+/// and the folds are recorded as the source is first read, so later passes need not draw them again.
+/// During the first complete training pass for a fold the instances of its test fold, which the pass must read past
+/// anyway, are held in memory, so that the test pass is served from memory without reading the source.
+/// When a filter first asks for a sample (see InstanceStream::sample), the pass it makes to take the sample for the
+/// first fold also collects the sample that the filter would take for every other fold, so that the later folds need
+/// no pass of their own to train the filter.
+
+class XValInstanceStream :
+  public InstanceStream
+{
+public:
+  XValInstanceStream(InstanceStream *source, const unsigned int noOfFolds, const unsigned int seed = 0);
+  ~XValInstanceStream(void);
+
+  // implementation of core InstanceStream methods
+  void rewind();                                              ///< return to the first instance in the stream
+  bool advance();                                             ///< advance, discarding the next instance in the stream.  Return true iff successful.
+  bool advance(instance &inst);                               ///< advance to the next instance in the stream.  Return true iff successful. @param inst the instance record to receive the new instance. 
+  bool canAdvanceDiscretised();                               ///< true iff the source supports advanceDiscretised
+  bool advanceDiscretised(instance &inst, const Cuts &cuts);  ///< advance to the next instance in the stream, discretised by the source.  Return true iff successful.
+  bool isAtEnd();                                             ///< true if we have advanced past the last instance
+  InstanceCount size();                                       ///< the number of instances in the stream.  This may require a pass through the stream to determine so should be used only if absolutely necessary.
+  unsigned int advance(InstanceBatch &batch, const unsigned int n);  ///< advance over up to n instances, storing them in the batch.  Return the number stored.
+  bool sample(const InstanceCount n, const bool approximate, std::vector<instance> &insts);  ///< the sample of the training fold, if it has been collected
+  bool countPairs(xxyDist &dist, WorkerPool *pool);           ///< count the pairs of attributes of the substream from the bitmap index of the source, if it keeps one
+
+  // cross validation specific methods
+  void startSubstream(const unsigned int fold, const bool training);      ///< start training or testing for a new fold
+
+private:
+  /// the fold of instance i of the source, drawn when the instance is first read
+  inline unsigned int foldOf(const InstanceCount i) {
+    while (i >= folds_.size()) folds_.push_back(static_cast<unsigned short>(rand_() % noOfFolds_));
+    return folds_[i];
+  }
+
+  bool skip();                   ///< pass over the next instance of the source, which is not in the substream, holding it if the test fold is being held.  Return true iff successful.
+  void endOfSource();            ///< record that the source has been read to its end
+  void startSamples();           ///< prepare to collect the sample of every fold in the current pass
+  void stopSamples();            ///< stop collecting the samples, as the pass does not read every instance in full
+  void addToSamples(const instance &inst, const unsigned int fold);  ///< offer an instance of a fold to the sample of every other fold
+
+  InstanceStream* source_;       ///< the source stream
+  MTRand_int32 rand_;            ///< random number generator for selecting folds
+  const unsigned int seed_;      ///< the random number seed
+  const unsigned int noOfFolds_; ///< the number of folds
+  unsigned int fold_;            ///< the current fold
+  bool training_;                ///< true if the current pass is a training pass. If true, the stream returns instances from the training fold. If false, the stream returns instances from all folds other than the training fold.
+  InstanceCount count_;          ///< a count of the number of instances in the stream
+  std::vector<unsigned short> folds_;  ///< the fold of each instance of the source read so far
+  InstanceCount next_;           ///< the index in the source of its next instance
+
+  InstanceStreamMemory testFold_;  ///< the instances of the test fold heldFold_
+  unsigned int heldFold_;        ///< the fold whose test instances are held, or noOfFolds_ if none are
+  bool holding_;                 ///< true iff the current pass is holding the instances of the test fold
+  bool fromHeld_;                ///< true iff the current pass returns the held instances of the test fold
+  bool canHold_;                 ///< false once a test fold has needed more than MAX_HELD_BYTES
+  instance heldInst_;            ///< receives each instance of the test fold as it is held
+
+  InstanceCount sampleSize_;     ///< the number of instances in the sample of each fold
+  bool samplesWanted_;           ///< true iff the samples of the folds are to be collected
+  bool sampling_;                ///< true iff the current pass is collecting the samples of the folds
+  bool samplesReady_;            ///< true iff the sample of every fold has been collected
+  std::vector<std::vector<NumValue> > sampleVals_;  ///< for each fold, the numeric values of each instance of its sample
+  std::vector<std::vector<CatValue> > sampleClasses_;  ///< for each fold, the class of each instance of its sample
+  std::vector<InstanceCount> sampleSeen_;  ///< for each fold, the number of its training instances offered to its sample
+  ptrVec<MTRand_int32> sampleRand_;  ///< for each fold, the generator that selects its sample
+
+  static const size_t MAX_HELD_BYTES = 1 << 28;  ///< the most memory a test fold may occupy, beyond which the test folds are read from the source
+  static const size_t MAX_SAMPLE_BYTES = 1 << 28;  ///< the most memory the samples of the folds may occupy, beyond which each fold takes its sample by a pass
+};
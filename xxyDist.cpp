@@ -1,108 +1,386 @@
-/* Open source system for classification learning from very large data
-** Copyright (C) 2012 Geoffrey I Webb
-**
-** This program is free software: you can redistribute it and/or modify
-** it under the terms of the GNU General Public License as published by
-** the Free Software Foundation, either version 3 of the License, or
-** (at your option) any later version.
-** 
-** This program is distributed in the hope that it will be useful,
-** but WITHOUT ANY WARRANTY; without even the implied warranty of
-** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
-** GNU General Public License for more details.
-** 
-** You should have received a copy of the GNU General Public License
-** along with this program. If not, see <http://www.gnu.org/licenses/>.
-**
-** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
-*/
-#include "xxyDist.h"
-#include "utils.h"
-#include <assert.h>
-
-xxyDist::xxyDist() {
-}
-
-xxyDist::xxyDist(InstanceStream& stream) : noOfClasses_(stream.getNoClasses()) {
-  reset(stream);
-  
-  // pass through the stream updating the counts incrementally
-  stream.rewind();
-
-  instance i;
-
-  while (stream.advance(i)) {
-    update(i);
-  }
-}
-
-xxyDist::~xxyDist(void)
-{
-}
-
-void xxyDist::reset(InstanceStream& stream) {
-  metaData_ = stream.getMetaData();
-
-  noOfClasses_  = stream.getNoClasses();
-
-  xyCounts.reset(&stream);
-
-#if 0
-  offset1.resize(stream.getNoCatAtts());
-  offset2.resize(stream.getNoCatAtts());
-
-  int next = 0;
-
-  for (CategoricalAttribute a = 0; a < stream.getNoCatAtts(); a++) {
-    offset1[a] = next;
-    next += stream.getNoValues(a) * stream.getNoClasses();
-  }
-
-  next = 0;
-
-  for (CategoricalAttribute a = 0; a < stream.getNoCatAtts(); a++) {
-    offset2[a] = next;
-    next += stream.getNoValues(a) * offset1[a];
-  }
-
-  countSize = next;
-  count.assign(next, 0);
-#endif
-
-  count_.resize(stream.getNoCatAtts());
-
-  for (CategoricalAttribute x1 = 1; x1 < stream.getNoCatAtts(); x1++) {
-    count_[x1].resize(stream.getNoValues(x1) * x1);
-
-    for (CatValue v1 = 0; v1 < stream.getNoValues(x1); ++v1) {
-      for (CategoricalAttribute x2 = 0; x2 < x1; x2++) {
-        count_[x1][v1*x1+x2].assign(stream.getNoValues(x2)*noOfClasses_, 0);
-      }
-    }
-  }
-}
-
-void xxyDist::update(const instance& i) {
-  xyCounts.update(i);
-
-  const CatValue theClass = i.getClass();
-
-  for (CategoricalAttribute x1 = 1; x1 < getNoCatAtts(); x1++) {
-    const CatValue v1 = i.getCatVal(x1);
-    XYSubDist xySubDist(getXYSubDist(x1, v1), noOfClasses_);
-
-    for (CategoricalAttribute x2 = 0; x2 < x1; x2++) {
-      const CatValue v2 = i.getCatVal(x2);
-
-      xySubDist.incCount(x2, v2, theClass);
-
-      assert(*ref(x1,v1,x2,v2,theClass) <= xyCounts.count);
-    }
-  }
-}
-
-
-void xxyDist::clear(){
-  count_.clear();
-  xyCounts.clear();
-}
+/* Open source system for classification learning from very large data
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "xxyDist.h"
+#include "instanceBatch.h"
+#include "bitmapIndex.h"
+#include "utils.h"
+#include <algorithm>
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+
+xxyDist::xxyDist() : counts_(NULL), countBytes_(0), firstX1_(1), endX1_(1), noCatAtts_(0), noOfClasses_(0) {
+}
+
+xxyDist::xxyDist(InstanceStream& stream) : counts_(NULL), countBytes_(0), firstX1_(1), endX1_(1), noCatAtts_(0), noOfClasses_(stream.getNoClasses()) {
+  reset(stream);
+  
+  // pass through the stream updating the counts incrementally
+  stream.rewind();
+
+  instance i;
+
+  while (stream.advance(i)) {
+    update(i);
+  }
+}
+
+xxyDist::~xxyDist(void)
+{
+  freeCounts();
+}
+
+void xxyDist::freeCounts() {
+  free(counts_);
+  counts_ = NULL;
+  countBytes_ = 0;
+}
+
+// allocate an array of bytes aligned to a cache line, so that the sub distributions of the pairs share as few lines as possible
+static unsigned char *allocCounts(const size_t bytes) {
+#ifdef _MSC_VER
+  unsigned char *counts = static_cast<unsigned char*>(malloc(bytes + 1));
+#else
+  void *c;
+  unsigned char *counts = posix_memalign(&c, 64, bytes + 1) == 0 ? static_cast<unsigned char*>(c) : NULL;
+#endif
+  if (counts == NULL) error("Out of memory");
+
+  return counts;
+}
+
+size_t xxyDist::getBytes() const {
+  return countBytes_;
+}
+
+// each row starts on a cache line, as its counts are updated together
+size_t xxyDist::layOut(const std::vector<unsigned int> &widths, std::vector<size_t> &offsets) const {
+  size_t bytes = 0;
+
+  offsets.assign(noCatAtts_, 0);
+
+  for (CategoricalAttribute x1 = firstX1_; x1 < endX1_; x1++) {
+    offsets[x1] = bytes;
+    bytes += (getRowSize(x1) * widths[x1] + 63) & ~static_cast<size_t>(63);
+  }
+
+  return bytes;
+}
+
+void xxyDist::reset(InstanceStream& stream) {
+  reset(stream, 1, stream.getNoCatAtts());
+}
+
+void xxyDist::reset(InstanceStream& stream, const CategoricalAttribute firstX1, const CategoricalAttribute endX1) {
+  metaData_ = stream.getMetaData();
+
+  noOfClasses_  = stream.getNoClasses();
+  noCatAtts_ = stream.getNoCatAtts();
+
+  xyCounts.reset(&stream);
+
+  firstX1_ = firstX1;
+  endX1_ = endX1 > firstX1 ? endX1 : firstX1;
+
+  attOffset_.resize(noCatAtts_);
+
+  unsigned int next = 0;
+
+  for (CategoricalAttribute a = 0; a < noCatAtts_; a++) {
+    attOffset_[a] = next;
+    next += stream.getNoValues(a) * noOfClasses_;
+  }
+
+  freeCounts();
+
+  rowWidth_.assign(noCatAtts_, 2);
+  countBytes_ = layOut(rowWidth_, rowOffset_);
+  counts_ = allocCounts(countBytes_);
+  memset(counts_, 0, countBytes_);
+
+  x1Bounds_.clear();
+}
+
+void xxyDist::getBlocks(InstanceStream& stream, const size_t budget, std::vector<CategoricalAttribute> &bounds) {
+  const unsigned int noCatAtts = stream.getNoCatAtts();
+
+  bounds.assign(1, 1);
+
+  size_t blockBytes = 0;
+  size_t attOffset = noCatAtts == 0 ? 0 : static_cast<size_t>(stream.getNoValues(0)) * stream.getNoClasses();
+
+  for (CategoricalAttribute x1 = 1; x1 < noCatAtts; x1++) {
+    const size_t bytes = stream.getNoValues(x1) * attOffset * sizeof(unsigned int);
+
+    if (budget != 0 && blockBytes != 0 && blockBytes + bytes > budget) {
+      bounds.push_back(x1);
+      blockBytes = 0;
+    }
+
+    blockBytes += bytes;
+    attOffset += static_cast<size_t>(stream.getNoValues(x1)) * stream.getNoClasses();
+  }
+
+  bounds.push_back(noCatAtts > 1 ? noCatAtts : 1);
+}
+
+// the greatest count of x1=v1, y in xyCounts, which bounds every count in the row of x1
+InstanceCount xxyDist::getBound(const CategoricalAttribute x1) const {
+  InstanceCount bound = 0;
+
+  for (CatValue v1 = 0; v1 < getNoValues(x1); v1++) {
+    for (CatValue y = 0; y < noOfClasses_; y++) {
+      if (xyCounts.getCount(x1, v1, y) > bound) bound = xyCounts.getCount(x1, v1, y);
+    }
+  }
+
+  return bound;
+}
+
+/// widen the counts of the rows whose xy counts show that one could exceed their width.  Every row that is within a factor of
+/// two of overflowing is widened with them, and the counts are copied to a new array laid out for the new widths.
+void xxyDist::widen() {
+  bool full = false;
+
+  for (CategoricalAttribute x1 = firstX1_; x1 < endX1_ && !full; x1++) {
+    full = getBound(x1) > maxCount(rowWidth_[x1]);
+  }
+
+  if (!full) return;
+
+  std::vector<unsigned int> widths(rowWidth_);
+
+  for (CategoricalAttribute x1 = firstX1_; x1 < endX1_; x1++) {
+    const InstanceCount bound = getBound(x1);
+
+    while (widths[x1] < sizeof(InstanceCount) && bound > maxCount(widths[x1]) / 2) widths[x1] *= 2;
+  }
+
+  std::vector<size_t> offsets;
+  const size_t bytes = layOut(widths, offsets);
+  unsigned char *counts = allocCounts(bytes);
+
+  for (CategoricalAttribute x1 = firstX1_; x1 < endX1_; x1++) {
+    const size_t size = getRowSize(x1);
+    const unsigned char *oldRow = getRow(x1);
+    unsigned char *row = counts + offsets[x1];
+
+    if (widths[x1] == rowWidth_[x1]) {
+      memcpy(row, oldRow, size * widths[x1]);
+    }
+    else if (widths[x1] == 4) {
+      for (size_t i = 0; i < size; i++) reinterpret_cast<unsigned int*>(row)[i] = static_cast<unsigned int>(getCountOfWidth(oldRow, rowWidth_[x1], i));
+    }
+    else {
+      for (size_t i = 0; i < size; i++) reinterpret_cast<unsigned long long*>(row)[i] = getCountOfWidth(oldRow, rowWidth_[x1], i);
+    }
+  }
+
+  free(counts_);
+  counts_ = counts;
+  countBytes_ = bytes;
+  rowOffset_.swap(offsets);
+  rowWidth_.swap(widths);
+}
+
+void xxyDist::update(const instance& i) {
+  xyCounts.update(i);
+
+  const CatValue theClass = i.getClass();
+
+  for (CategoricalAttribute x1 = firstX1_; x1 < endX1_; x1++) {
+    // only the count of x1=v1, y has grown, so it alone can require a wider row
+    if (xyCounts.getCount(x1, i.getCatVal(x1), theClass) > maxCount(rowWidth_[x1])) widen();
+
+    switch (rowWidth_[x1]) {
+    case 2: updateRow<unsigned short>(i, x1); break;
+    case 4: updateRow<unsigned int>(i, x1); break;
+    default: updateRow<unsigned long long>(i, x1); break;
+    }
+  }
+}
+
+template <typename C>
+void xxyDist::updateRow(const instance& i, const CategoricalAttribute x1) {
+  C *x1Counts = reinterpret_cast<C*>(getRow(x1)) + static_cast<size_t>(i.getCatVal(x1))*attOffset_[x1] + i.getClass();
+
+  for (CategoricalAttribute x2 = 0; x2 < x1; x2++) {
+    x1Counts[attOffset_[x2] + i.getCatVal(x2)*noOfClasses_]++;
+  }
+}
+
+void xxyDist::update(const InstanceBatch& batch) {
+  xyCounts.update(batch);
+
+  widen();
+
+  updateRange(batch, firstX1_, endX1_);
+}
+
+/// update the distribution from a batch, each worker of the pool counting the pairs for its own range of x1.  The counts for
+/// each x1 are contiguous and are updated by only one worker, so the result is the same as from update(batch).
+void xxyDist::update(const InstanceBatch& batch, WorkerPool &pool) {
+  xyCounts.update(batch);
+
+  widen();
+
+  if (x1Bounds_.size() != pool.size() + 1) partition(pool.size());
+
+  BatchUpdater updater(*this, batch);
+
+  pool.run(updater);
+}
+
+// x1 is paired with x1 attributes, so the ranges are chosen to hold about equal sums of x1
+void xxyDist::partition(const unsigned int noWorkers) {
+  double noPairs = 0;
+
+  for (CategoricalAttribute x1 = firstX1_; x1 < endX1_; x1++) {
+    noPairs += x1;
+  }
+
+  x1Bounds_.assign(noWorkers + 1, endX1_);
+  x1Bounds_[0] = firstX1_;
+
+  double pairs = 0;
+  unsigned int w = 1;
+
+  for (CategoricalAttribute x1 = firstX1_; x1 < endX1_ && w < noWorkers; x1++) {
+    pairs += x1;
+    if (pairs >= noPairs * w / noWorkers) x1Bounds_[w++] = x1 + 1;
+  }
+}
+
+void xxyDist::updateRange(const InstanceBatch& batch, const CategoricalAttribute firstX1, const CategoricalAttribute endX1) {
+  switch (batch.getCatWidth()) {
+  case 1: updateCols<unsigned char>(batch, firstX1, endX1); break;
+  case 2: updateCols<unsigned short>(batch, firstX1, endX1); break;
+  default: updateCols<CatValue>(batch, firstX1, endX1); break;
+  }
+}
+
+template <typename T>
+void xxyDist::updateCols(const InstanceBatch& batch, const CategoricalAttribute firstX1, const CategoricalAttribute endX1) {
+  for (CategoricalAttribute x1 = firstX1; x1 < endX1; x1++) {
+    switch (rowWidth_[x1]) {
+    case 2: updateRow<T, unsigned short>(batch, x1); break;
+    case 4: updateRow<T, unsigned int>(batch, x1); break;
+    default: updateRow<T, unsigned long long>(batch, x1); break;
+    }
+  }
+}
+
+template <typename T, typename C>
+void xxyDist::updateRow(const InstanceBatch& batch, const CategoricalAttribute x1) {
+  const unsigned int n = batch.size();
+  const CatValue *y = batch.getClasses();
+  const T *v1 = batch.getCatCol<T>(x1);
+  C *x1Counts[InstanceBatch::MAX_SIZE];  // the sub distribution of the value of x1 for each instance
+
+  assert(n <= InstanceBatch::MAX_SIZE);
+
+  for (unsigned int i = 0; i < n; i++) {
+    x1Counts[i] = reinterpret_cast<C*>(getRow(x1)) + static_cast<size_t>(v1[i])*attOffset_[x1] + y[i];
+  }
+
+  for (CategoricalAttribute x2 = 0; x2 < x1; x2++) {
+    const T *v2 = batch.getCatCol<T>(x2);
+    const unsigned int offset = attOffset_[x2];
+
+    for (unsigned int i = 0; i < n; i++) {
+      x1Counts[i][offset + v2[i]*noOfClasses_]++;
+    }
+  }
+}
+
+void xxyDist::update(const BitmapIndex& index, const unsigned long long* mask) {
+  xyCounts.update(index, mask);
+
+  widen();
+
+  updateRange(index, mask, firstX1_, endX1_);
+}
+
+/// update the distribution from an index, each worker of the pool counting the pairs for its own range of x1, as for a batch
+void xxyDist::update(const BitmapIndex& index, const unsigned long long* mask, WorkerPool &pool) {
+  xyCounts.update(index, mask);
+
+  widen();
+
+  if (x1Bounds_.size() != pool.size() + 1) partition(pool.size());
+
+  IndexUpdater updater(*this, index, mask);
+
+  pool.run(updater);
+}
+
+void xxyDist::updateRange(const BitmapIndex& index, const unsigned long long* mask, const CategoricalAttribute firstX1, const CategoricalAttribute endX1) {
+  if (index.getNoWords() == 0) return;
+
+  std::vector<unsigned long long> v1y(index.getNoWords());
+
+  for (CategoricalAttribute x1 = firstX1; x1 < endX1; x1++) {
+    switch (rowWidth_[x1]) {
+    case 2: updateRow<unsigned short>(index, mask, x1, &v1y[0]); break;
+    case 4: updateRow<unsigned int>(index, mask, x1, &v1y[0]); break;
+    default: updateRow<unsigned long long>(index, mask, x1, &v1y[0]); break;
+    }
+  }
+}
+
+/// For each v1 and y the instances with x1=v1, y are intersected once, and then with the bitmap of each x2=v2.  Every instance
+/// has one value of x2, so the count of its last value is what remains of the count of x1=v1, y.
+template <typename C>
+void xxyDist::updateRow(const BitmapIndex& index, const unsigned long long* mask, const CategoricalAttribute x1, unsigned long long* v1y) {
+  const size_t n = index.getNoWords();
+
+  for (CatValue v1 = 0; v1 < getNoValues(x1); v1++) {
+    for (CatValue y = 0; y < noOfClasses_; y++) {
+      InstanceCount count = BitmapIndex::intersect(index.getValueBits(x1, v1), index.getClassBits(y), v1y, n);
+
+      if (count != 0 && mask != NULL) count = BitmapIndex::intersect(v1y, mask, v1y, n);
+
+      if (count == 0) continue;
+
+      C *x1Counts = reinterpret_cast<C*>(getRow(x1)) + static_cast<size_t>(v1)*attOffset_[x1] + y;
+
+      for (CategoricalAttribute x2 = 0; x2 < x1; x2++) {
+        C *counts = x1Counts + attOffset_[x2];
+        const CatValue last = getNoValues(x2) - 1;
+        InstanceCount rest = count;
+
+        for (CatValue v2 = 0; v2 < last && rest != 0; v2++) {
+          const InstanceCount c = BitmapIndex::countAnd(v1y, index.getValueBits(x2, v2), n);
+
+          counts[v2*noOfClasses_] += static_cast<C>(c);
+          rest -= c;
+        }
+
+        counts[last*noOfClasses_] += static_cast<C>(rest);
+      }
+    }
+  }
+}
+
+void xxyDist::clear(){
+  freeCounts();
+  noCatAtts_ = 0;
+  firstX1_ = endX1_ = 1;
+  xyCounts.clear();
+}
@@ -1,165 +1,253 @@
-/* Open source system for classification learning from very large data
-** Copyright (C) 2012 Geoffrey I Webb
-** Class for handling a joint distribution between two attributes and a class
-**
-** This program is free software: you can redistribute it and/or modify
-** it under the terms of the GNU General Public License as published by
-** the Free Software Foundation, either version 3 of the License, or
-** (at your option) any later version.
-** 
-** This program is distributed in the hope that it will be useful,
-** but WITHOUT ANY WARRANTY; without even the implied warranty of
-** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
-** GNU General Public License for more details.
-** 
-** You should have received a copy of the GNU General Public License
-** along with this program. If not, see <http://www.gnu.org/licenses/>.
-**
-** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
-*/
-#pragma once
-
-#include "instanceStream.h"
-#include "xyDist.h"
-
-class constXYSubDist {
-public:
-  constXYSubDist(const std::vector<InstanceCount>* subDist, const unsigned int noOfClasses) : subDist_(subDist), noOfClasses_(noOfClasses) {}
-
-  inline const ySubDist getYSubDist(const CategoricalAttribute x, const CatValue v) const { return &subDist_[x][v*noOfClasses_]; }
-  inline const InstanceCount getCount(const CategoricalAttribute x, const CatValue v, const CatValue y) const { return subDist_[x][v*noOfClasses_+y]; }
-
-private:
-  const std::vector<InstanceCount>* subDist_;
-  const unsigned int noOfClasses_;
-};
-
-class XYSubDist {
-public:
-  XYSubDist(std::vector<InstanceCount>* subDist, const unsigned int noOfClasses) : subDist_(subDist), noOfClasses_(noOfClasses) {}
-
-  inline ySubDist getYSubDist(const CategoricalAttribute x, const CatValue v) { return &subDist_[x][v*noOfClasses_]; }
-  inline InstanceCount getCount(const CategoricalAttribute x, const CatValue v, const CatValue y) { return subDist_[x][v*noOfClasses_+y]; }
-  inline void incCount(const CategoricalAttribute x, const CatValue v, const CatValue y) { ++subDist_[x][v*noOfClasses_+y]; }
-
-  std::vector<InstanceCount>* subDist_;
-  const unsigned int noOfClasses_;
-};
-
-class xxyDist
-{
-public:
-  xxyDist();
-  xxyDist(InstanceStream& stream);
-  ~xxyDist(void);
-
-  void reset(InstanceStream& stream);
-
-  void update(const instance& i);
-  
-  void clear();
-
-  // p(x1=v1, x2=v2, Y=y) unsmoothed
-  inline double rawJointP(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2, CatValue y) const {
-    return (*constRef(x1,v1,x2,v2,y))/(xyCounts.count);
-  }
-
-  // p(x1=v1, x2=v2, Y=y) using M-estimate
-  inline double jointP(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2, CatValue y) const {
-    return (*constRef(x1,v1,x2,v2,y)+M/(metaData_->getNoValues(x1)*metaData_->getNoValues(x2)*noOfClasses_))/(xyCounts.count+M);
-  }
-
-  // p(x1=v1, x2=v2) using M-estimate
-  inline double jointP(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2) const {
-    return (getCount(x1,v1,x2,v2)+M/(metaData_->getNoValues(x1)*metaData_->getNoValues(x2)))/(xyCounts.count+M);
-  }
-
-  // p(x1=v1|Y=y, x2=v2) using M-estimate
-  inline double p(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2, CatValue y) const {
-    return (*constRef(x1,v1,x2,v2,y)+M/metaData_->getNoValues(x1))/(xyCounts.getCount(x2,v2,y)+M);
-  }
-
-  //inline double p(CatValue y) const {
-  //  return xyCounts.p(y);
-  //}
-
-  // p(x1=v1, x2=v2, Y=y) unsmoothed
-  inline InstanceCount getCount(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2, CatValue y) const {
-    return *constRef(x1,v1,x2,v2,y);
-  }
-
-  // count for instances x1=v1, x2=v2
-  inline InstanceCount getCount(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2) const {
-    InstanceCount c = 0;
-
-    for (CatValue y = 0; y < noOfClasses_; y++) {
-      c+= getCount(x1,v1,x2,v2,y);
-    }
-    return c;
-  }
-
-  inline unsigned int getNoCatAtts() const { return count_.size(); }
-
-  inline unsigned int getNoValues(const CategoricalAttribute a) const { return metaData_->getNoValues(a); }
-
-  inline unsigned int getNoClasses() const { return noOfClasses_; }
-
-  inline std::vector<InstanceCount>* getXYSubDist(CategoricalAttribute x1, CatValue v1) { 
-    return &count_[x1][v1*x1];
-  }
-
-private:
-  // count_[X1=x1][X2=x2][Y=y]
-  inline InstanceCount *ref(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2, CatValue y) {
-    if (x2 > x1) {
-      CatValue t = x1;
-      x1 = x2;
-      x2 = t;
-      t = v1;
-      v1 = v2;
-      v2 = t;
-    }
-
-    return &count_[x1][v1*x1+x2][v2*noOfClasses_+y];
-  }
-
-  // count_[X1=x1][X2=x2]
-  inline InstanceCount *xxref(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2) {
-    if (x2 > x1) {
-      CatValue t = x1;
-      x1 = x2;
-      x2 = t;
-      t = v1;
-      v1 = v2;
-      v2 = t;
-    }
-
-    return &count_[x1][v1*x1+x2][v2*noOfClasses_];
-  }
-
-  // count_[X1=x1][X2=x2][Y=y]
-  inline const InstanceCount *constRef(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2, CatValue y) const {
-    if (x2 > x1) {
-      CatValue t = x1;
-      x1 = x2;
-      x2 = t;
-      t = v1;
-      v1 = v2;
-      v2 = t;
-    }
-
-    return &count_[x1][v1*x1+x2][v2*noOfClasses_+y];
-  }
-
-public:
-  xyDist xyCounts;
-
-private:
-  InstanceStream::MetaData* metaData_;
-  // a three-dimensional semiflattened representation of count_[X1=x1][X2=x2][Y=y] storing only X1 > X2
-  // outer vector is indexed by X1
-  // middle vector is indexed by x1*X2
-  // inner vector is indexed by x2*y
-  std::vector<std::vector<std::vector<InstanceCount> > > count_;
-  unsigned int noOfClasses_;
-};
+/* Open source system for classification learning from very large data
+** Copyright (C) 2012 Geoffrey I Webb
+** Class for handling a joint distribution between two attributes and a class
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#pragma once
+
+#include "instanceStream.h"
+#include "xyDist.h"
+#include "workerPool.h"
+
+class BitmapIndex;
+
+#include <limits>
+#include <vector>
+
+/// the count at index i of an array of counts that are each width bytes: 2, 4 or 8
+inline InstanceCount getCountOfWidth(const unsigned char* counts, const unsigned int width, const size_t i) {
+  switch (width) {
+  case 2: return reinterpret_cast<const unsigned short*>(counts)[i];
+  case 4: return reinterpret_cast<const unsigned int*>(counts)[i];
+  default: return reinterpret_cast<const unsigned long long*>(counts)[i];
+  }
+}
+
+/// the counts of x2=v2, y for every x2 < x1, for one value v1 of an attribute x1, in the row of x1 of an xxyDist
+class constXYSubDist {
+public:
+  constXYSubDist(const unsigned char* subDist, const unsigned int width, const unsigned int* offsets, const unsigned int noOfClasses) : subDist_(subDist), width_(width), offsets_(offsets), noOfClasses_(noOfClasses) {}
+
+  inline const InstanceCount getCount(const CategoricalAttribute x, const CatValue v, const CatValue y) const { return getCountOfWidth(subDist_, width_, offsets_[x] + v*noOfClasses_ + y); }
+
+private:
+  const unsigned char* subDist_;
+  const unsigned int width_;         ///< the number of bytes of each count
+  const unsigned int* offsets_;      ///< the offset of the counts of each attribute x2 within the sub distribution
+  const unsigned int noOfClasses_;
+};
+
+/// the counts of x2=v2, y for every x2 < x1, for one value v1 of an attribute x1, in the row of x1 of an xxyDist.
+/// A client that increments the counts itself must keep them within the width of the row, as xxyDist::update() does by
+/// widening the row when xyCounts shows that a count could exceed it.
+class XYSubDist {
+public:
+  XYSubDist(unsigned char* subDist, const unsigned int width, const unsigned int* offsets, const unsigned int noOfClasses) : subDist_(subDist), width_(width), offsets_(offsets), noOfClasses_(noOfClasses) {}
+
+  inline InstanceCount getCount(const CategoricalAttribute x, const CatValue v, const CatValue y) const { return getCountOfWidth(subDist_, width_, offsets_[x] + v*noOfClasses_ + y); }
+  inline void incCount(const CategoricalAttribute x, const CatValue v, const CatValue y) {
+    const size_t i = offsets_[x] + v*noOfClasses_ + y;
+
+    switch (width_) {
+    case 2: ++reinterpret_cast<unsigned short*>(subDist_)[i]; break;
+    case 4: ++reinterpret_cast<unsigned int*>(subDist_)[i]; break;
+    default: ++reinterpret_cast<unsigned long long*>(subDist_)[i]; break;
+    }
+  }
+
+  inline operator constXYSubDist() const { return constXYSubDist(subDist_, width_, offsets_, noOfClasses_); }
+
+private:
+  unsigned char* subDist_;
+  const unsigned int width_;         ///< the number of bytes of each count
+  const unsigned int* offsets_;      ///< the offset of the counts of each attribute x2 within the sub distribution
+  const unsigned int noOfClasses_;
+};
+
+/// The joint distribution of each pair of categorical attributes and the class.
+/// The counts are held in one contiguous, cache line aligned array.  The counts for each attribute x1 form a row that starts
+/// at the cache line aligned byte offset rowOffset_[x1] of the array, in which the counts of x1=v1, x2=v2, y (for x2 < x1)
+/// are at static_cast<size_t>(v1)*attOffset_[x1] + attOffset_[x2] + v2*noOfClasses + y.  attOffset_[x] is the number of
+/// counts of x'=v', y for all x' < x, which is also the size of the sub distribution for each value of x.
+///
+/// Each row starts with counts of two bytes, and is widened to four and then eight bytes before any of its counts can overflow.
+/// A count of x1=v1, x2=v2, y cannot exceed the count of x1=v1, y in xyCounts, which is updated first, so a row is widened
+/// when that count exceeds what its counts can hold.  The array is then laid out afresh, the offset of each row following
+/// from the widths of the rows before it.  So that the array is not laid out again for each row in turn, the rows that are
+/// within a factor of two of overflowing are widened at the same time.  Most rows of most data sets stay narrow, halving the
+/// memory and cache traffic of four byte counts, yet the counts are correct for any number of instances.
+///
+/// When the counts of every pair do not fit in memory, the distribution can hold just a block of the pairs: those for x1 in
+/// [getFirstX1(), getEndX1()).  Only the rows of the block are laid out, and only the counts of the pairs in the block may
+/// be read.  getBlocks() divides the attributes into blocks that fit a budget, to be counted one per pass.
+///
+/// The counts can also be taken from a BitmapIndex of the instances, without a pass: the count of x1=v1, x2=v2, y is the number
+/// of bits set in the intersection of the bitmaps of x1=v1, y and x2=v2.
+class xxyDist
+{
+public:
+  xxyDist();
+  xxyDist(InstanceStream& stream);
+  ~xxyDist(void);
+
+  void reset(InstanceStream& stream);  ///< reset the distribution to hold the counts of every pair
+  void reset(InstanceStream& stream, const CategoricalAttribute firstX1, const CategoricalAttribute endX1);  ///< reset the distribution to hold the counts of the pairs for x1 in [firstX1, endX1)
+
+  /// divide the attributes x1 into blocks whose pair counts occupy at most budget bytes, block b holding x1 in [bounds[b], bounds[b+1]).
+  /// An attribute whose pairs alone exceed the budget has a block to itself.  A budget of 0 gives a single block of every pair.
+  /// The blocks are sized for counts of four bytes, the widest a row becomes with fewer than 2^32 instances.
+  static void getBlocks(InstanceStream& stream, const size_t budget, std::vector<CategoricalAttribute> &bounds);
+
+  void update(const instance& i);
+  void update(const InstanceBatch& batch);  ///< update the distribution according to each instance in the batch, one pair of attributes at a time
+  void update(const InstanceBatch& batch, WorkerPool &pool);  ///< update the distribution from a batch, each worker of the pool counting the pairs for its own range of x1
+  void update(const BitmapIndex& index, const unsigned long long* mask);  ///< update the distribution according to each instance of the index whose bit is set in mask, or every instance if mask is NULL, from the intersections of its bitmaps
+  void update(const BitmapIndex& index, const unsigned long long* mask, WorkerPool &pool);  ///< update the distribution from an index, each worker of the pool counting the pairs for its own range of x1
+  
+  void clear();
+
+  // p(x1=v1, x2=v2, Y=y) unsmoothed
+  inline double rawJointP(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2, CatValue y) const {
+    return getCount(x1,v1,x2,v2,y)/static_cast<double>(xyCounts.count);
+  }
+
+  // p(x1=v1, x2=v2, Y=y) using M-estimate
+  inline double jointP(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2, CatValue y) const {
+    return (getCount(x1,v1,x2,v2,y)+M/(metaData_->getNoValues(x1)*metaData_->getNoValues(x2)*noOfClasses_))/(xyCounts.count+M);
+  }
+
+  // p(x1=v1, x2=v2) using M-estimate
+  inline double jointP(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2) const {
+    return (getCount(x1,v1,x2,v2)+M/(metaData_->getNoValues(x1)*metaData_->getNoValues(x2)))/(xyCounts.count+M);
+  }
+
+  // p(x1=v1|Y=y, x2=v2) using M-estimate
+  inline double p(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2, CatValue y) const {
+    return (getCount(x1,v1,x2,v2,y)+M/metaData_->getNoValues(x1))/(xyCounts.getCount(x2,v2,y)+M);
+  }
+
+  //inline double p(CatValue y) const {
+  //  return xyCounts.p(y);
+  //}
+
+  // p(x1=v1, x2=v2, Y=y) unsmoothed
+  inline InstanceCount getCount(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2, CatValue y) const {
+    if (x2 > x1) {
+      CatValue t = x1;
+      x1 = x2;
+      x2 = t;
+      t = v1;
+      v1 = v2;
+      v2 = t;
+    }
+
+    return getCountOfWidth(getRow(x1), rowWidth_[x1], static_cast<size_t>(v1)*attOffset_[x1] + attOffset_[x2] + v2*noOfClasses_ + y);
+  }
+
+  // count for instances x1=v1, x2=v2
+  inline InstanceCount getCount(CategoricalAttribute x1, CatValue v1, CategoricalAttribute x2, CatValue v2) const {
+    InstanceCount c = 0;
+
+    for (CatValue y = 0; y < noOfClasses_; y++) {
+      c+= getCount(x1,v1,x2,v2,y);
+    }
+    return c;
+  }
+
+  inline unsigned int getNoCatAtts() const { return noCatAtts_; }
+
+  inline CategoricalAttribute getFirstX1() const { return firstX1_; }  ///< the first x1 whose pairs are held
+  inline CategoricalAttribute getEndX1() const { return endX1_; }      ///< one past the last x1 whose pairs are held
+
+  inline unsigned int getNoValues(const CategoricalAttribute a) const { return metaData_->getNoValues(a); }
+
+  inline unsigned int getNoClasses() const { return noOfClasses_; }
+
+  inline XYSubDist getXYSubDist(CategoricalAttribute x1, CatValue v1) {
+    return XYSubDist(getRow(x1) + static_cast<size_t>(v1)*attOffset_[x1]*rowWidth_[x1], rowWidth_[x1], &attOffset_[0], noOfClasses_);
+  }
+
+  inline constXYSubDist getXYSubDist(CategoricalAttribute x1, CatValue v1) const {
+    return constXYSubDist(getRow(x1) + static_cast<size_t>(v1)*attOffset_[x1]*rowWidth_[x1], rowWidth_[x1], &attOffset_[0], noOfClasses_);
+  }
+
+  size_t getBytes() const;              ///< the number of bytes holding the counts of the pairs
+
+private:
+  template <typename T>
+  void updateCols(const InstanceBatch& batch, const CategoricalAttribute firstX1, const CategoricalAttribute endX1);  ///< update the counts of the pairs for x1 in [firstX1, endX1) from a batch whose categorical columns are of type T
+  template <typename T, typename C>
+  void updateRow(const InstanceBatch& batch, const CategoricalAttribute x1);  ///< update the row of x1, whose counts are of type C, from a batch whose categorical columns are of type T
+  template <typename C>
+  void updateRow(const instance& i, const CategoricalAttribute x1);  ///< update the row of x1, whose counts are of type C, from an instance
+  template <typename C>
+  void updateRow(const BitmapIndex& index, const unsigned long long* mask, const CategoricalAttribute x1, unsigned long long* v1y);  ///< update the row of x1, whose counts are of type C, from an index, using v1y to hold a bitmap
+  void widen();                         ///< widen the counts of the rows whose xy counts show that one could exceed their width, laying out the array afresh
+  InstanceCount getBound(const CategoricalAttribute x1) const;  ///< the greatest count of x1=v1, y, which bounds every count in the row of x1
+  size_t layOut(const std::vector<unsigned int> &widths, std::vector<size_t> &offsets) const;  ///< set the offset of each row of the block for rows of the given widths and return the bytes the array needs
+  inline unsigned char *getRow(const CategoricalAttribute x1) const { return counts_ + rowOffset_[x1]; }  ///< the counts of the row of x1
+  inline size_t getRowSize(const CategoricalAttribute x1) const { return static_cast<size_t>(getNoValues(x1)) * attOffset_[x1]; }  ///< the number of counts in the row of x1
+
+  /// the greatest count that a count of width bytes can hold
+  static inline InstanceCount maxCount(const unsigned int width) { return width >= sizeof(InstanceCount) ? std::numeric_limits<InstanceCount>::max() : (static_cast<InstanceCount>(1) << (8 * width)) - 1; }
+  void updateRange(const InstanceBatch& batch, const CategoricalAttribute firstX1, const CategoricalAttribute endX1);  ///< update the counts of the pairs for x1 in [firstX1, endX1) from a batch
+  void updateRange(const BitmapIndex& index, const unsigned long long* mask, const CategoricalAttribute firstX1, const CategoricalAttribute endX1);  ///< update the counts of the pairs for x1 in [firstX1, endX1) from an index
+  void partition(const unsigned int noWorkers);  ///< divide the attributes x1 into a range for each worker, each with about the same number of pairs
+
+  /// updates the counts from a batch, each worker updating the pairs for its range of x1
+  class BatchUpdater : public WorkerPool::Task {
+  public:
+    BatchUpdater(xxyDist &dist, const InstanceBatch &batch) : dist_(dist), batch_(batch) {}
+    void run(const unsigned int worker) { dist_.updateRange(batch_, dist_.x1Bounds_[worker], dist_.x1Bounds_[worker + 1]); }
+  private:
+    xxyDist &dist_;
+    const InstanceBatch &batch_;
+  };
+
+  /// updates the counts from an index, each worker updating the pairs for its range of x1
+  class IndexUpdater : public WorkerPool::Task {
+  public:
+    IndexUpdater(xxyDist &dist, const BitmapIndex &index, const unsigned long long *mask) : dist_(dist), index_(index), mask_(mask) {}
+    void run(const unsigned int worker) { dist_.updateRange(index_, mask_, dist_.x1Bounds_[worker], dist_.x1Bounds_[worker + 1]); }
+  private:
+    xxyDist &dist_;
+    const BitmapIndex &index_;
+    const unsigned long long *mask_;
+  };
+
+  xxyDist(const xxyDist &);             // the counts are not copied
+  xxyDist &operator=(const xxyDist &);
+
+  void freeCounts();                    ///< release the array of counts
+
+public:
+  xyDist xyCounts;
+
+private:
+  InstanceStream::MetaData* metaData_;
+  // a flat representation of count[X1=x1][X2=x2][Y=y] storing only X1 > X2
+  unsigned char *counts_;                 ///< the row of each x1 of the block, holding the counts of x1=v1, x2=v2, y for every v1, x2 < x1, v2 and y
+  size_t countBytes_;                     ///< the number of bytes of counts_
+  std::vector<size_t> rowOffset_;         ///< the byte offset within counts_ of the row of each x1 of the block
+  std::vector<unsigned int> rowWidth_;    ///< the number of bytes of each count in the row of each x1: 2, 4 or 8
+  std::vector<unsigned int> attOffset_;   ///< for each attribute x, the offset of its counts within a sub distribution
+  std::vector<CategoricalAttribute> x1Bounds_;  ///< worker w of a pool updates the pairs for x1 in [x1Bounds_[w], x1Bounds_[w+1])
+  CategoricalAttribute firstX1_;          ///< the first x1 whose pairs are held
+  CategoricalAttribute endX1_;            ///< one past the last x1 whose pairs are held
+  unsigned int noCatAtts_;
+  unsigned int noOfClasses_;
+};
@@ -1,74 +1,179 @@
-/* Open source system for classification learning from very large data
-** Copyright (C) 2012 Geoffrey I Webb
-**
-** This program is free software: you can redistribute it and/or modify
-** it under the terms of the GNU General Public License as published by
-** the Free Software Foundation, either version 3 of the License, or
-** (at your option) any later version.
-** 
-** This program is distributed in the hope that it will be useful,
-** but WITHOUT ANY WARRANTY; without even the implied warranty of
-** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
-** GNU General Public License for more details.
-** 
-** You should have received a copy of the GNU General Public License
-** along with this program. If not, see <http://www.gnu.org/licenses/>.
-**
-** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
-*/
-#include "xyDist.h"
-#include "utils.h"
-
-#include <memory.h>
-
-xyDist::xyDist() {
-}
-
-xyDist::xyDist(InstanceStream *is)
-{
-  reset(is);
-
-  instance inst(*is);
-
-  while (!is->isAtEnd()) {
-    if (is->advance(inst)) update(inst);
-  }
-}
-
-xyDist::~xyDist(void)
-{
-}
-
-void xyDist::reset(InstanceStream *is) {
-
-  metaData_ = is->getMetaData();
-  noOfClasses_ = is->getNoClasses();
-  count = 0;
-
-  counts_.resize(is->getNoCatAtts());
-
-  for (CategoricalAttribute a = 0; a < is->getNoCatAtts(); a++) {
-    counts_[a].assign(is->getNoValues(a)*noOfClasses_, 0);
-  }
-
-  classCounts.assign(noOfClasses_, 0);
-}
-
-void xyDist::update(const instance &inst) {
-  count++;
-
-  const CatValue y = inst.getClass();
-
-  classCounts[y]++;
-
-  for (CategoricalAttribute a = 0; a < metaData_->getNoCatAtts(); a++) {
-    counts_[a][inst.getCatVal(a)*noOfClasses_+y]++;
-  }
-}
-
-void xyDist::clear(){
-  classCounts.clear();
-  for (CategoricalAttribute a = 0; a < getNoAtts(); a++) {
-    counts_[a].assign(metaData_->getNoValues(a)*noOfClasses_, 0);
-  }
-}
+/* Open source system for classification learning from very large data
+** Copyright (C) 2012 Geoffrey I Webb
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program. If not, see <http://www.gnu.org/licenses/>.
+**
+** Please report any bugs to Geoff Webb <geoff.webb@monash.edu>
+*/
+#include "xyDist.h"
+#include "instanceBatch.h"
+#include "bitmapIndex.h"
+#include "utils.h"
+
+#include <limits>
+#include <memory.h>
+
+xyDist::xyDist() : wide_(false) {
+}
+
+xyDist::xyDist(InstanceStream *is)
+{
+  reset(is);
+
+  instance inst(*is);
+
+  while (!is->isAtEnd()) {
+    if (is->advance(inst)) update(inst);
+  }
+}
+
+xyDist::~xyDist(void)
+{
+}
+
+void xyDist::reset(InstanceStream *is) {
+
+  metaData_ = is->getMetaData();
+  noOfClasses_ = is->getNoClasses();
+  count = 0;
+  wide_ = false;
+
+  counts_.resize(is->getNoCatAtts());
+
+  for (CategoricalAttribute a = 0; a < is->getNoCatAtts(); a++) {
+    counts_[a].assign(is->getNoValues(a)*noOfClasses_, 0);
+  }
+
+  classCounts.assign(noOfClasses_, 0);
+}
+
+void xyDist::reserve(const InstanceCount n) {
+  if (wide_ || count + n <= std::numeric_limits<unsigned int>::max()) return;
+
+  // append a zero high word for each count
+  for (CategoricalAttribute a = 0; a < counts_.size(); a++) {
+    counts_[a].resize(2 * counts_[a].size(), 0);
+  }
+
+  wide_ = true;
+}
+
+void xyDist::addCount(const CategoricalAttribute a, const unsigned int i, const InstanceCount c) {
+  std::vector<unsigned int> &counts = counts_[a];
+
+  if (!wide_) {
+    counts[i] += static_cast<unsigned int>(c);
+    return;
+  }
+
+  const InstanceCount sum = counts[i] + c;
+
+  counts[i] = static_cast<unsigned int>(sum);
+  counts[counts.size()/2 + i] += static_cast<unsigned int>(sum >> 32);
+}
+
+void xyDist::update(const instance &inst) {
+  reserve(1);
+
+  count++;
+
+  const CatValue y = inst.getClass();
+
+  classCounts[y]++;
+
+  for (CategoricalAttribute a = 0; a < metaData_->getNoCatAtts(); a++) {
+    addCount(a, inst.getCatVal(a)*noOfClasses_+y, 1);
+  }
+}
+
+void xyDist::update(const InstanceBatch &batch) {
+  // instantiate the loops for the width of the batch's values
+  switch (batch.getCatWidth()) {
+  case 1: updateCols<unsigned char>(batch); break;
+  case 2: updateCols<unsigned short>(batch); break;
+  default: updateCols<CatValue>(batch); break;
+  }
+}
+
+template <typename T>
+void xyDist::updateCols(const InstanceBatch &batch) {
+  const unsigned int n = batch.size();
+  const CatValue *y = batch.getClasses();
+
+  reserve(n);
+
+  count += n;
+
+  for (unsigned int i = 0; i < n; i++) {
+    classCounts[y[i]]++;
+  }
+
+  for (CategoricalAttribute a = 0; a < metaData_->getNoCatAtts(); a++) {
+    const T *v = batch.getCatCol<T>(a);
+
+    if (wide_) {
+      for (unsigned int i = 0; i < n; i++) {
+        addCount(a, v[i]*noOfClasses_+y[i], 1);
+      }
+      continue;
+    }
+
+    unsigned int *counts = &counts_[a][0];
+
+    for (unsigned int i = 0; i < n; i++) {
+      counts[v[i]*noOfClasses_+y[i]]++;
+    }
+  }
+}
+
+/// update the distribution from the counts of the intersections of the bitmaps of each value and each class
+void xyDist::update(const BitmapIndex &index, const unsigned long long *mask) {
+  const size_t n = index.getNoWords();
+
+  if (n == 0) return;
+
+  reserve(index.size());
+
+  std::vector<unsigned long long> yBits(mask == NULL ? 0 : n);  // the instances of class y in the mask
+
+  for (CatValue y = 0; y < noOfClasses_; y++) {
+    const unsigned long long *bits = index.getClassBits(y);
+    InstanceCount c;
+
+    if (mask == NULL) c = BitmapIndex::count(bits, n);
+    else {
+      c = BitmapIndex::intersect(bits, mask, &yBits[0], n);
+      bits = &yBits[0];
+    }
+
+    count += c;
+    classCounts[y] += c;
+
+    if (c == 0) continue;
+
+    for (CategoricalAttribute a = 0; a < metaData_->getNoCatAtts(); a++) {
+      for (CatValue v = 0; v < metaData_->getNoValues(a); v++) {
+        addCount(a, v*noOfClasses_+y, BitmapIndex::countAnd(index.getValueBits(a, v), bits, n));
+      }
+    }
+  }
+}
+
+void xyDist::clear(){
+  classCounts.clear();
+  wide_ = false;
+  for (CategoricalAttribute a = 0; a < getNoAtts(); a++) {
+    counts_[a].assign(metaData_->getNoValues(a)*noOfClasses_, 0);
+  }
+}